@@ -53,7 +53,6 @@ typedef u32_t (*DemoExternalErrorHook_t)(const comrvErrorArgs_t* pErrorArgs);
 /**
 * external prototypes
 */
-extern u32_t xcrc32(const u08_t *pBuf, s32_t siLen, u32_t uiInit);
 
 /**
 * global variables
@@ -161,7 +160,7 @@ void comrvErrorHook(const comrvErrorArgs_t* pErrorArgs)
 u32_t comrvCrcCalcHook(const void* pAddress, u16_t usMemSizeInBytes, u32_t uiExpectedResult)
 {
    volatile u32_t uiCrc;
-   uiCrc = xcrc32(pAddress, usMemSizeInBytes, 0xffffffff);
+   uiCrc = pspCrc32(pAddress, usMemSizeInBytes, D_PSP_CRC_INIT);
    return !(uiExpectedResult == uiCrc);
 }
 #endif /* D_COMRV_ENABLE_CRC_SUPPORT */
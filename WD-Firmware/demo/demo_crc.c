@@ -0,0 +1,160 @@
+/*
+* SPDX-License-Identifier: Apache-2.0
+* Copyright 2026 Western Digital Corporation or its affiliates.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http:*www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/**
+* @file   demo_crc.c
+* @author Western Digital
+* @date   16.10.2026
+* @brief  Demo application for the PSP CRC module.
+*         pspCrc32 is verified against xcrc32 (the byte-at-a-time CRC used for the
+*         overlays) for all the alignments of the buffer, for small sizes and for data
+*         split across buffers, and pspCrc32c against the CRC32C check value. Then the
+*         cycles of a 4 KB CRC are printed for xcrc32, pspCrc32 and pspCrc32c
+*/
+
+/**
+* include files
+*/
+#include "psp_api.h"
+#include "demo_platform_al.h"
+#include "demo_utils.h"
+
+/**
+* definitions
+*/
+#define D_DEMO_BUFFER_SIZE          0x1000   /* 4 KB */
+#define D_DEMO_MAX_OFFSET           4        /* All the alignments of a word */
+#define D_DEMO_MAX_CHECK_SIZE       40       /* A few words with head and tail */
+#define D_DEMO_CRC32C_CHECK         0xE3069283   /* CRC32C of "123456789" */
+
+/**
+* macros
+*/
+#define M_DEMO_VERIFY(bCondition)   if (!(bCondition)) \
+                                    { \
+                                      M_DEMO_ERR_PRINT(); \
+                                      M_PSP_EBREAK(); \
+                                    }
+
+/**
+* types
+*/
+
+/**
+* local prototypes
+*/
+
+/**
+* external prototypes
+*/
+extern u32_t xcrc32(const u08_t *pBuf, s32_t siLen, u32_t uiInit);
+
+/**
+* global variables
+*/
+u32_t g_uiDemoBuffer[D_DEMO_BUFFER_SIZE / sizeof(u32_t)];
+
+/**
+* APIs
+*/
+
+/**
+ * @brief - Fill the buffer with a pseudo random sequence
+ */
+void demoCrcFill(u08_t* pArea, u32_t uiSizeInBytes)
+{
+  u32_t uiIndex, uiSeed = 1;
+
+  for (uiIndex = 0; uiIndex < uiSizeInBytes; uiIndex++)
+  {
+    uiSeed = uiSeed * 1103515245 + 12345;
+    pArea[uiIndex] = (u08_t)(uiSeed >> 16);
+  }
+}
+
+/**
+ * @brief - Verify pspCrc32 against xcrc32 and pspCrc32c against the check value
+ */
+void demoCrcVerify(void)
+{
+  u08_t* pBuffer = (u08_t*)g_uiDemoBuffer;
+  u32_t uiOffset, uiSize, uiCrc;
+
+  /* All the alignments and small sizes */
+  for (uiOffset = 0; uiOffset < D_DEMO_MAX_OFFSET; uiOffset++)
+  {
+    for (uiSize = 0; uiSize < D_DEMO_MAX_CHECK_SIZE; uiSize++)
+    {
+      M_DEMO_VERIFY(pspCrc32(&pBuffer[uiOffset], uiSize, D_PSP_CRC_INIT) ==
+                    xcrc32(&pBuffer[uiOffset], uiSize, D_PSP_CRC_INIT));
+    }
+  }
+
+  /* The whole buffer, and the same buffer in two unaligned parts */
+  uiCrc = xcrc32(pBuffer, D_DEMO_BUFFER_SIZE, D_PSP_CRC_INIT);
+  M_DEMO_VERIFY(pspCrc32(pBuffer, D_DEMO_BUFFER_SIZE, D_PSP_CRC_INIT) == uiCrc);
+  M_DEMO_VERIFY(pspCrc32(&pBuffer[1001], D_DEMO_BUFFER_SIZE - 1001,
+                         pspCrc32(pBuffer, 1001, D_PSP_CRC_INIT)) == uiCrc);
+
+  /* CRC32C check value */
+  M_DEMO_VERIFY(D_DEMO_CRC32C_CHECK == ~pspCrc32c("123456789", 9, D_PSP_CRC_INIT));
+}
+
+/**
+ * @brief - Print the cycles of the CRC of a 4 KB buffer
+ */
+void demoCrcBenchmark(void)
+{
+  u32_t uiStart, uiXcrc32Cycles, uiCrc32Cycles, uiCrc32cCycles;
+
+  uiStart = M_PSP_READ_CSR(D_PSP_MCYCLE_NUM);
+  xcrc32((const u08_t*)g_uiDemoBuffer, D_DEMO_BUFFER_SIZE, D_PSP_CRC_INIT);
+  uiXcrc32Cycles = M_PSP_READ_CSR(D_PSP_MCYCLE_NUM) - uiStart;
+
+  uiStart = M_PSP_READ_CSR(D_PSP_MCYCLE_NUM);
+  pspCrc32(g_uiDemoBuffer, D_DEMO_BUFFER_SIZE, D_PSP_CRC_INIT);
+  uiCrc32Cycles = M_PSP_READ_CSR(D_PSP_MCYCLE_NUM) - uiStart;
+
+  uiStart = M_PSP_READ_CSR(D_PSP_MCYCLE_NUM);
+  pspCrc32c(g_uiDemoBuffer, D_DEMO_BUFFER_SIZE, D_PSP_CRC_INIT);
+  uiCrc32cCycles = M_PSP_READ_CSR(D_PSP_MCYCLE_NUM) - uiStart;
+
+#ifdef D_PSP_CRC_USE_CLMUL
+  demoOutputMsg("CRC engine: clmul\n");
+#else
+  demoOutputMsg("CRC engine: slice-by-4 tables\n");
+#endif /* D_PSP_CRC_USE_CLMUL */
+  demoOutputMsg("CRC 4KB: xcrc32 %d cycles, pspCrc32 %d cycles, pspCrc32c %d cycles\n",
+                uiXcrc32Cycles, uiCrc32Cycles, uiCrc32cCycles);
+}
+
+/**
+ * @brief - demoStart - startup point of the demo application. called from main function.
+ *
+ */
+void demoStart(void)
+{
+  M_DEMO_START_PRINT();
+
+  pspCrcInit();
+  demoCrcFill((u08_t*)g_uiDemoBuffer, D_DEMO_BUFFER_SIZE);
+
+  demoCrcVerify();
+  demoCrcBenchmark();
+
+  M_DEMO_END_PRINT();
+}
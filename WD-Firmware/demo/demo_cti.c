@@ -48,7 +48,6 @@ typedef u32_t (*DemoExternalErrorHook_t)(const comrvErrorArgs_t* pErrorArgs);
 * external prototypes
 */
 extern void* _OVERLAY_STORAGE_START_ADDRESS_;
-extern u32_t xcrc32(const u08_t *pBuf, s32_t siLen, u32_t uiInit);
 
 /**
 * global variables
@@ -69,6 +68,9 @@ void demoStart(void)
    /* Register interrupt vector */
    pspMachineInterruptsSetVecTableAddress(&M_PSP_VECT_TABLE);
 
+   /* Init the CRC engine of the overlays */
+   pspCrcInit();
+
    /* Init ComRV engine */
    comrvInit(&stComrvInitArgs);
 
@@ -181,7 +183,7 @@ void comrvInvalidateDataCacheHook(const void* pAddress, u32_t uiNumSizeInBytes)
 u32_t comrvCrcCalcHook(const void* pAddress, u16_t usMemSizeInBytes, u32_t uiExpectedResult)
 {
    volatile u32_t uiCrc;
-   uiCrc = xcrc32(pAddress, usMemSizeInBytes, 0xffffffff);
+   uiCrc = pspCrc32(pAddress, usMemSizeInBytes, D_PSP_CRC_INIT);
    return !(uiExpectedResult == uiCrc);
 }
 #endif /* D_COMRV_ENABLE_CRC_SUPPORT */
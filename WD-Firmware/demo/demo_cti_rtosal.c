@@ -68,7 +68,6 @@ void demoTestTaskB(void* pValueToSend);
 * external prototypes
 */
 extern void* _OVERLAY_STORAGE_START_ADDRESS_;
-extern u32_t xcrc32(const u08_t *pBuf, s32_t siLen, u32_t uiInit);
 
 /**
 * global variables
@@ -104,6 +103,9 @@ void demoStart(void)
       /* Disable the timer interrupts until setup is done. */
       pspMachineInterruptsDisableIntNumber(D_PSP_INTERRUPTS_MACHINE_TIMER);
 
+      /* Init the CRC engine of the overlays */
+      pspCrcInit();
+
       /* Init ComRV engine */
       comrvInit(&stComrvInitArgs);
 
@@ -377,7 +379,7 @@ u32_t comrvExitCriticalSectionHook(void)
 u32_t comrvCrcCalcHook(const void* pAddress, u16_t usMemSizeInBytes, u32_t uiExpectedResult)
 {
    volatile u32_t uiCrc;
-   uiCrc = xcrc32(pAddress, usMemSizeInBytes, 0xffffffff);
+   uiCrc = pspCrc32(pAddress, usMemSizeInBytes, D_PSP_CRC_INIT);
    return !(uiExpectedResult == uiCrc);
 }
 #endif /* D_COMRV_ENABLE_CRC_SUPPORT */
@@ -0,0 +1,212 @@
+/*
+* SPDX-License-Identifier: Apache-2.0
+* Copyright 2026 Western Digital Corporation or its affiliates.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http:*www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/**
+* @file   demo_ipi.c
+* @author Western Digital
+* @date   16.10.2026
+* @brief  Demo application for the inter-hart messaging (IPI) service on EH2.
+*         Hart1 halts until its doorbell is rung, and hart0 posts bursts of messages
+*         to it. Hart1 verifies the order of the messages and prints the number of
+*         interrupts it took against the number of messages it handled - a burst is
+*         coalesced into a single interrupt
+*/
+
+/**
+* include files
+*/
+#include "psp_api.h"
+#include "demo_platform_al.h"
+#include "demo_utils.h"
+
+/**
+* definitions
+*/
+#define D_DEMO_NUMBER_OF_HARTS                         2
+#define D_DEMO_NUM_OF_MESSAGES                         1000
+#define D_DEMO_BURST_SIZE                              8
+#define D_DEMO_ATOMICALLY_ENABLE_INTERRUPTS_UPON_HALT  1
+
+/* Sync points */
+#define D_DEMO_SYNC_IPI_READY                          0
+#define D_DEMO_SYNC_IPI_END                            1
+#define D_DEMO_NUM_OF_SYNC_POINTS                      2
+
+/**
+* macros
+*/
+
+/**
+* types
+*/
+typedef enum demoHartNum
+{
+  E_HART0     = 0,
+  E_HART1     = 1,
+  E_LAST_HART,
+} eDemoHartNum_t;
+
+/**
+* local prototypes
+*/
+
+/**
+* external prototypes
+*/
+
+/**
+* global variables
+*/
+volatile u32_t g_uiDemoNumOfReceived;
+
+u32_t g_uiDemoSyncPoint[D_DEMO_NUM_OF_SYNC_POINTS];
+
+/**
+* APIs
+*/
+
+/**
+ * @brief - Each hart spins here on a global synchronization point, to make sure both harts
+ *          start the next activity, following this function, simultaneously
+ */
+void demoIpiSpinOnSyncPoint(volatile u32_t* pSyncPoint)
+{
+  M_PSP_ATOMIC_AMO_ADD((u32_t*)pSyncPoint, 1);
+  while (D_DEMO_NUMBER_OF_HARTS > *pSyncPoint){};
+}
+
+/**
+ * @brief - Handler of the messages hart1 receives. The messages are received in the
+ *          order they were sent
+ */
+void demoIpiHandler(u32_t uiMessage)
+{
+  if (g_uiDemoNumOfReceived != uiMessage)
+  {
+    M_DEMO_ERR_PRINT();
+    M_PSP_EBREAK();
+  }
+  g_uiDemoNumOfReceived++;
+}
+
+/**
+ * @brief - Hart0 posts all the messages to hart1, a burst at a time
+ */
+void demoIpiSend(void)
+{
+  u32_t uiBurst[D_DEMO_BURST_SIZE];
+  u32_t uiSent = 0, uiPosted = 0, uiIndex, uiBurstSize;
+
+  while (D_DEMO_NUM_OF_MESSAGES > uiSent)
+  {
+    uiBurstSize = D_DEMO_NUM_OF_MESSAGES - uiSent;
+    if (D_DEMO_BURST_SIZE < uiBurstSize)
+    {
+      uiBurstSize = D_DEMO_BURST_SIZE;
+    }
+
+    for (uiIndex = 0; uiIndex < uiBurstSize; uiIndex++)
+    {
+      uiBurst[uiIndex] = uiSent + uiIndex;
+    }
+
+    /* Repost the rest of the burst while the mailbox of hart1 is full */
+    for (uiPosted = 0; uiPosted < uiBurstSize; )
+    {
+      uiPosted += pspIpiPostBatch(E_HART1, &uiBurst[uiPosted], uiBurstSize - uiPosted);
+    }
+
+    uiSent += uiBurstSize;
+  }
+}
+
+/**
+ * @brief - Hart1 halts until all the messages are received. The interrupts are enabled
+ *          atomically upon halt, so a doorbell rung after the check still wakes hart1
+ */
+void demoIpiReceive(void)
+{
+  u32_t uiInterruptsStatus, uiNumOfInterrupts, uiNumOfMessages;
+
+  pspMachineInterruptsDisable(&uiInterruptsStatus);
+  while (D_DEMO_NUM_OF_MESSAGES > g_uiDemoNumOfReceived)
+  {
+    pspMachinePowerMngCtrlHalt(D_DEMO_ATOMICALLY_ENABLE_INTERRUPTS_UPON_HALT);
+    pspMachineInterruptsDisable(&uiInterruptsStatus);
+  }
+  pspMachineInterruptsEnable();
+
+  pspIpiGetStats(&uiNumOfInterrupts, &uiNumOfMessages);
+  if (D_DEMO_NUM_OF_MESSAGES != uiNumOfMessages)
+  {
+    M_DEMO_ERR_PRINT();
+    M_PSP_EBREAK();
+  }
+
+  demoOutputMsg("IPI: %d messages, %d interrupts\n", uiNumOfMessages, uiNumOfInterrupts);
+}
+
+/**
+ * @brief - demoStart - startup point of the demo application. called from main function.
+ *
+ */
+void demoStart(void)
+{
+  u32_t uiHartId = M_PSP_MACHINE_GET_HART_ID();
+
+  /* Both harts use the same vector table */
+  pspMachineInterruptsSetVecTableAddress(&M_PSP_VECT_TABLE);
+
+  if (E_HART0 == uiHartId)
+  {
+    M_DEMO_START_PRINT();
+
+    /* Initialize PSP internal mutexs */
+    pspMutexInitPspMutexs();
+
+    /* Initialize the sync points */
+    pspMemsetBytes((void*)g_uiDemoSyncPoint, 0, sizeof(g_uiDemoSyncPoint));
+    g_uiDemoNumOfReceived = 0;
+
+    /* start hart1 */
+    asm volatile ("csrrwi x0, 0x7fc, 3");
+  }
+  else
+  {
+    /* Hart1 receives the messages */
+    pspIpiInit(demoIpiHandler);
+  }
+
+  /* Hart0 posts only after the mailbox of hart1 is initialized */
+  demoIpiSpinOnSyncPoint(&g_uiDemoSyncPoint[D_DEMO_SYNC_IPI_READY]);
+
+  if (E_HART0 == uiHartId)
+  {
+    demoIpiSend();
+  }
+  else
+  {
+    demoIpiReceive();
+  }
+
+  demoIpiSpinOnSyncPoint(&g_uiDemoSyncPoint[D_DEMO_SYNC_IPI_END]);
+
+  if (E_HART0 == uiHartId)
+  {
+    M_DEMO_END_PRINT();
+  }
+}
@@ -0,0 +1,243 @@
+/*
+* SPDX-License-Identifier: Apache-2.0
+* Copyright 2026 Western Digital Corporation or its affiliates.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http:*www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/**
+* @file   demo_memory_utils.c
+* @author Western Digital
+* @date   16.10.2026
+* @brief  Demo application for the PSP memory utilities.
+*         (1) Verify pspMemset, pspMemcpy, pspMemmove, pspMemcmp and pspStrlen against
+*             byte-by-byte loops, for all the alignments and for small sizes
+*         (2) Print the cycles of setting and copying a 16 KB buffer, byte by byte and
+*             with the PSP functions
+*/
+
+/**
+* include files
+*/
+#include "psp_api.h"
+#include "demo_platform_al.h"
+#include "demo_utils.h"
+
+/**
+* definitions
+*/
+#define D_DEMO_BUFFER_SIZE          0x4000   /* 16 KB */
+#define D_DEMO_MAX_OFFSET           4        /* All the alignments of a word */
+#define D_DEMO_MAX_CHECK_SIZE       40       /* A few unrolled loop iterations with head and tail */
+#define D_DEMO_CHECK_AREA_SIZE      128
+#define D_DEMO_PATTERN              0xA5
+
+/**
+* macros
+*/
+#define M_DEMO_VERIFY(bCondition)   if (!(bCondition)) \
+                                    { \
+                                      M_DEMO_ERR_PRINT(); \
+                                      M_PSP_EBREAK(); \
+                                    }
+
+/**
+* types
+*/
+
+/**
+* local prototypes
+*/
+
+/**
+* external prototypes
+*/
+
+/**
+* global variables
+*/
+u32_t g_uiDemoBuffer1[D_DEMO_BUFFER_SIZE / sizeof(u32_t)];
+u32_t g_uiDemoBuffer2[D_DEMO_BUFFER_SIZE / sizeof(u32_t)];
+u08_t g_ucDemoCheck1[D_DEMO_CHECK_AREA_SIZE];
+u08_t g_ucDemoCheck2[D_DEMO_CHECK_AREA_SIZE];
+
+/**
+* APIs
+*/
+
+/**
+ * @brief - Reference byte loops. The volatile access keeps one store per byte
+ */
+void demoMemsetByteLoop(void* pMemory, u08_t ucVal, u32_t uiSizeInBytes)
+{
+  volatile u08_t* pByte = (volatile u08_t*)pMemory;
+
+  while (0 != uiSizeInBytes--)
+  {
+    *pByte++ = ucVal;
+  }
+}
+
+void demoMemcpyByteLoop(void* pDestination, const void* pSource, u32_t uiSizeInBytes)
+{
+  volatile u08_t* pDstByte = (volatile u08_t*)pDestination;
+  const u08_t* pSrcByte = (const u08_t*)pSource;
+
+  while (0 != uiSizeInBytes--)
+  {
+    *pDstByte++ = *pSrcByte++;
+  }
+}
+
+void demoMemmoveByteLoop(void* pDestination, const void* pSource, u32_t uiSizeInBytes)
+{
+  u08_t ucTemp[D_DEMO_MAX_CHECK_SIZE];
+
+  demoMemcpyByteLoop(ucTemp, pSource, uiSizeInBytes);
+  demoMemcpyByteLoop(pDestination, ucTemp, uiSizeInBytes);
+}
+
+/**
+ * @brief - Fill an area with a known sequence
+ */
+void demoMemoryFill(u08_t* pArea, u32_t uiSizeInBytes, u32_t uiSeed)
+{
+  u32_t uiIndex;
+
+  for (uiIndex = 0; uiIndex < uiSizeInBytes; uiIndex++)
+  {
+    pArea[uiIndex] = (u08_t)(uiIndex * 7 + uiSeed);
+  }
+}
+
+/**
+ * @brief - Compare two areas byte by byte
+ */
+u32_t demoMemoryIsEqual(const u08_t* pArea1, const u08_t* pArea2, u32_t uiSizeInBytes)
+{
+  u32_t uiIndex;
+
+  for (uiIndex = 0; uiIndex < uiSizeInBytes; uiIndex++)
+  {
+    if (pArea1[uiIndex] != pArea2[uiIndex])
+    {
+      return D_PSP_FALSE;
+    }
+  }
+
+  return D_PSP_TRUE;
+}
+
+/**
+ * @brief - Verify the PSP memory utilities for all the alignments of the destination and
+ *          the source and for small sizes. The bytes around the handled range must not change
+ */
+void demoMemoryUtilsVerify(void)
+{
+  u32_t uiDstOffset, uiSrcOffset, uiSize;
+  u08_t* pDst;
+  u08_t* pSrc;
+
+  for (uiDstOffset = 0; uiDstOffset < D_DEMO_MAX_OFFSET; uiDstOffset++)
+  {
+    for (uiSrcOffset = 0; uiSrcOffset < D_DEMO_MAX_OFFSET; uiSrcOffset++)
+    {
+      for (uiSize = 0; uiSize < D_DEMO_MAX_CHECK_SIZE; uiSize++)
+      {
+        pDst = &g_ucDemoCheck1[uiDstOffset + D_DEMO_MAX_OFFSET];
+        pSrc = &g_ucDemoCheck2[uiSrcOffset + D_DEMO_MAX_OFFSET];
+
+        /* pspMemset */
+        demoMemoryFill(g_ucDemoCheck1, D_DEMO_CHECK_AREA_SIZE, 1);
+        demoMemoryFill(g_ucDemoCheck2, D_DEMO_CHECK_AREA_SIZE, 1);
+        pspMemset(pDst, D_DEMO_PATTERN, uiSize);
+        demoMemsetByteLoop(&g_ucDemoCheck2[uiDstOffset + D_DEMO_MAX_OFFSET], D_DEMO_PATTERN, uiSize);
+        M_DEMO_VERIFY(demoMemoryIsEqual(g_ucDemoCheck1, g_ucDemoCheck2, D_DEMO_CHECK_AREA_SIZE));
+
+        /* pspMemcpy and pspMemcmp */
+        demoMemoryFill(g_ucDemoCheck1, D_DEMO_CHECK_AREA_SIZE, 1);
+        demoMemoryFill(g_ucDemoCheck2, D_DEMO_CHECK_AREA_SIZE, 2);
+        pspMemcpy(pDst, pSrc, uiSize);
+        M_DEMO_VERIFY(demoMemoryIsEqual(pDst, pSrc, uiSize));
+        M_DEMO_VERIFY(0 == pspMemcmp(pDst, pSrc, uiSize));
+        M_DEMO_VERIFY(pDst[-1] == (u08_t)((uiDstOffset + D_DEMO_MAX_OFFSET - 1) * 7 + 1));
+        M_DEMO_VERIFY(pDst[uiSize] == (u08_t)((uiDstOffset + D_DEMO_MAX_OFFSET + uiSize) * 7 + 1));
+        if (0 != uiSize)
+        {
+          pSrc[uiSize - 1]++;
+          M_DEMO_VERIFY(0 > pspMemcmp(pDst, pSrc, uiSize));
+          M_DEMO_VERIFY(0 < pspMemcmp(pSrc, pDst, uiSize));
+        }
+
+        /* pspMemmove - the destination overlaps the source from above and from below */
+        demoMemoryFill(g_ucDemoCheck1, D_DEMO_CHECK_AREA_SIZE, 3);
+        demoMemoryFill(g_ucDemoCheck2, D_DEMO_CHECK_AREA_SIZE, 3);
+        pspMemmove(&g_ucDemoCheck1[uiDstOffset + D_DEMO_MAX_OFFSET + 5], &g_ucDemoCheck1[uiSrcOffset + D_DEMO_MAX_OFFSET], uiSize);
+        pspMemmove(&g_ucDemoCheck1[uiDstOffset + D_DEMO_MAX_OFFSET + 64], &g_ucDemoCheck1[uiSrcOffset + D_DEMO_MAX_OFFSET + 69], uiSize);
+        demoMemmoveByteLoop(&g_ucDemoCheck2[uiDstOffset + D_DEMO_MAX_OFFSET + 5], &g_ucDemoCheck2[uiSrcOffset + D_DEMO_MAX_OFFSET], uiSize);
+        demoMemmoveByteLoop(&g_ucDemoCheck2[uiDstOffset + D_DEMO_MAX_OFFSET + 64], &g_ucDemoCheck2[uiSrcOffset + D_DEMO_MAX_OFFSET + 69], uiSize);
+        M_DEMO_VERIFY(demoMemoryIsEqual(g_ucDemoCheck1, g_ucDemoCheck2, D_DEMO_CHECK_AREA_SIZE));
+
+        /* pspStrlen */
+        demoMemsetByteLoop(g_ucDemoCheck1, 'x', D_DEMO_CHECK_AREA_SIZE);
+        g_ucDemoCheck1[uiSrcOffset + uiSize] = '\0';
+        M_DEMO_VERIFY(uiSize == pspStrlen((const char*)&g_ucDemoCheck1[uiSrcOffset]));
+      }
+    }
+  }
+}
+
+/**
+ * @brief - Print the cycles of setting and copying a 16 KB buffer, byte by byte and with
+ *          the PSP functions
+ */
+void demoMemoryUtilsBenchmark(void)
+{
+  u32_t uiStart, uiByteLoopCycles, uiPspCycles;
+
+  uiStart = M_PSP_READ_CSR(D_PSP_MCYCLE_NUM);
+  demoMemsetByteLoop(g_uiDemoBuffer1, 0, D_DEMO_BUFFER_SIZE);
+  uiByteLoopCycles = M_PSP_READ_CSR(D_PSP_MCYCLE_NUM) - uiStart;
+  uiStart = M_PSP_READ_CSR(D_PSP_MCYCLE_NUM);
+  pspMemset(g_uiDemoBuffer1, 0, D_DEMO_BUFFER_SIZE);
+  uiPspCycles = M_PSP_READ_CSR(D_PSP_MCYCLE_NUM) - uiStart;
+  demoOutputMsg("memset 16KB: byte loop %d cycles, pspMemset %d cycles\n", uiByteLoopCycles, uiPspCycles);
+
+  uiStart = M_PSP_READ_CSR(D_PSP_MCYCLE_NUM);
+  demoMemcpyByteLoop(g_uiDemoBuffer2, g_uiDemoBuffer1, D_DEMO_BUFFER_SIZE);
+  uiByteLoopCycles = M_PSP_READ_CSR(D_PSP_MCYCLE_NUM) - uiStart;
+  uiStart = M_PSP_READ_CSR(D_PSP_MCYCLE_NUM);
+  pspMemcpy(g_uiDemoBuffer2, g_uiDemoBuffer1, D_DEMO_BUFFER_SIZE);
+  uiPspCycles = M_PSP_READ_CSR(D_PSP_MCYCLE_NUM) - uiStart;
+  demoOutputMsg("memcpy 16KB: byte loop %d cycles, pspMemcpy %d cycles\n", uiByteLoopCycles, uiPspCycles);
+
+  /* Source and destination that are not equally aligned */
+  uiStart = M_PSP_READ_CSR(D_PSP_MCYCLE_NUM);
+  pspMemcpy(g_uiDemoBuffer2, (u08_t*)g_uiDemoBuffer1 + 1, D_DEMO_BUFFER_SIZE - 1);
+  uiPspCycles = M_PSP_READ_CSR(D_PSP_MCYCLE_NUM) - uiStart;
+  demoOutputMsg("memcpy 16KB, source not aligned: pspMemcpy %d cycles\n", uiPspCycles);
+}
+
+/**
+ * @brief - demoStart - startup point of the demo application. called from main function.
+ *
+ */
+void demoStart(void)
+{
+  M_DEMO_START_PRINT();
+
+  demoMemoryUtilsVerify();
+  demoMemoryUtilsBenchmark();
+
+  M_DEMO_END_PRINT();
+}
@@ -429,8 +429,8 @@ void demoStart(void)
   /* count number of times we entered this function */
   if (E_HART0 == uiHartId)
   {
-    /* Setup vector table for Hart0 */
-    pspMachineInterruptsSetVecTableAddress(&M_PSP_VECT_TABLE_HART0);
+    /* Setup vector table for Hart0. Both harts use the same table - handlers are registered per hart */
+    pspMachineInterruptsSetVecTableAddress(&M_PSP_VECT_TABLE);
     uiCounter0++;
 
     /* Initialize PSP internal mutexs */
@@ -445,7 +445,7 @@ void demoStart(void)
   else
   {
     /* Setup vector table for Hart1 */
-    pspMachineInterruptsSetVecTableAddress(&M_PSP_VECT_TABLE_HART1);
+    pspMachineInterruptsSetVecTableAddress(&M_PSP_VECT_TABLE);
     uiCounter1++;
   }
 
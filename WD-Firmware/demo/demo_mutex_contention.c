@@ -0,0 +1,224 @@
+/*
+* SPDX-License-Identifier: Apache-2.0
+* Copyright 2026 Western Digital Corporation or its affiliates.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http:*www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/**
+* @file   demo_mutex_contention.c
+* @author Western Digital
+* @date   16.10.2026
+* @brief  Demo application for the EH2 inter-hart mutex lock algorithms under contention.
+*         Both harts hammer the same mutex and increment a shared counter. For each lock
+*         algorithm the demo verifies the counter and prints the acquire latency (mcycle)
+*         and the number of lock hand-overs between the harts (fairness)
+*/
+
+/**
+* include files
+*/
+#include "psp_api.h"
+#include "demo_platform_al.h"
+#include "demo_utils.h"
+
+/**
+* definitions
+*/
+#define D_DEMO_NUMBER_OF_HARTS         2
+#define D_DEMO_NUM_ITERATIONS          1000
+#define D_DEMO_NUMBER_OF_MUTEXES       1
+#define D_DEMO_NO_OWNER                0xFFFFFFFF
+
+/**
+* macros
+*/
+
+/**
+* types
+*/
+typedef enum demoHartNum
+{
+  E_HART0     = 0,
+  E_HART1     = 1,
+  E_LAST_HART,
+} eDemoHartNum_t;
+
+/* Acquire statistics of a hart */
+typedef struct demoLockStats
+{
+  u32_t uiMaxCycles;
+  u64_t udTotalCycles;
+} demoLockStats_t;
+
+/**
+* local prototypes
+*/
+
+/**
+* external prototypes
+*/
+
+/**
+* global variables
+*/
+/* Area for the mutex of this demo */
+pspMutexCb_t g_stMutexArea[D_DEMO_NUMBER_OF_MUTEXES];
+pspMutexCb_t* g_pDemoMutex = NULL;
+
+/* Sync points - one per test phase */
+u32_t g_uiDemoSyncPoint[(E_PSP_MUTEX_TYPE_LAST + 1) * 2];
+
+/* Data protected by the mutex */
+volatile u32_t g_uiDemoSharedCounter;
+volatile u32_t g_uiDemoLastOwner;
+volatile u32_t g_uiDemoHandovers;
+
+demoLockStats_t g_stDemoLockStats[D_DEMO_NUMBER_OF_HARTS];
+
+/**
+* APIs
+*/
+
+/**
+ * @brief - Each hart spins here on a global synchronization point, to make sure both harts
+ *          start the next activity, following this function, simultaneously
+ */
+void demoMutexSpinOnSyncPoint(volatile u32_t* pSyncPoint)
+{
+  M_PSP_ATOMIC_AMO_ADD((u32_t*)pSyncPoint, 1);
+  while (D_DEMO_NUMBER_OF_HARTS > *pSyncPoint){};
+}
+
+/**
+ * @brief - Run the contention test on one lock algorithm
+ *
+ * @input parameter - uiMutexType  - lock algorithm (E_PSP_MUTEX_TYPE_XXX)
+ * @input parameter - pSyncPoints  - two sync points of this test
+ * @input parameter - pTypeName    - name of the algorithm to print
+ */
+void demoMutexContention(u32_t uiMutexType, u32_t* pSyncPoints, const char* pTypeName)
+{
+  u32_t uiHartId = M_PSP_MACHINE_GET_HART_ID();
+  demoLockStats_t* pStats = &g_stDemoLockStats[uiHartId];
+  u32_t uiIterator, uiStart, uiCycles;
+
+  if (E_HART0 == uiHartId)
+  {
+    g_uiDemoSharedCounter = 0;
+    g_uiDemoHandovers = 0;
+    g_uiDemoLastOwner = D_DEMO_NO_OWNER;
+    g_stDemoLockStats[E_HART0].uiMaxCycles = 0;
+    g_stDemoLockStats[E_HART0].udTotalCycles = 0;
+    g_stDemoLockStats[E_HART1].uiMaxCycles = 0;
+    g_stDemoLockStats[E_HART1].udTotalCycles = 0;
+    g_pDemoMutex = pspMutexCreateByType(uiMutexType);
+    if (NULL == g_pDemoMutex)
+    {
+      M_DEMO_ERR_PRINT();
+      M_PSP_EBREAK();
+    }
+  }
+
+  /* Both harts start hammering the mutex together */
+  demoMutexSpinOnSyncPoint(&pSyncPoints[0]);
+
+  for (uiIterator = 0; uiIterator < D_DEMO_NUM_ITERATIONS; uiIterator++)
+  {
+    uiStart = M_PSP_READ_CSR(D_PSP_MCYCLE_NUM);
+    pspMutexAtomicLock(g_pDemoMutex);
+    uiCycles = M_PSP_READ_CSR(D_PSP_MCYCLE_NUM) - uiStart;
+
+    /* Critical section */
+    if (uiHartId != g_uiDemoLastOwner)
+    {
+      g_uiDemoHandovers++;
+      g_uiDemoLastOwner = uiHartId;
+    }
+    g_uiDemoSharedCounter++;
+
+    pspMutexAtomicUnlock(g_pDemoMutex);
+
+    pStats->udTotalCycles += uiCycles;
+    if (uiCycles > pStats->uiMaxCycles)
+    {
+      pStats->uiMaxCycles = uiCycles;
+    }
+  }
+
+  /* Both harts are done */
+  demoMutexSpinOnSyncPoint(&pSyncPoints[1]);
+
+  if (E_HART0 == uiHartId)
+  {
+    /* No increment may be lost */
+    if ((D_DEMO_NUMBER_OF_HARTS * D_DEMO_NUM_ITERATIONS) != g_uiDemoSharedCounter)
+    {
+      M_DEMO_ERR_PRINT();
+      M_PSP_EBREAK();
+    }
+
+    demoOutputMsg("%s lock: hand-overs %d\n", pTypeName, g_uiDemoHandovers);
+    demoOutputMsg("  hart0 acquire cycles: mean %d max %d\n",
+                  (u32_t)(g_stDemoLockStats[E_HART0].udTotalCycles / D_DEMO_NUM_ITERATIONS),
+                  g_stDemoLockStats[E_HART0].uiMaxCycles);
+    demoOutputMsg("  hart1 acquire cycles: mean %d max %d\n",
+                  (u32_t)(g_stDemoLockStats[E_HART1].udTotalCycles / D_DEMO_NUM_ITERATIONS),
+                  g_stDemoLockStats[E_HART1].uiMaxCycles);
+
+    /* NULL returned value indicates that mutex-destroy has been succeeded */
+    if (NULL != pspMutexDestroy(g_pDemoMutex))
+    {
+      M_DEMO_ERR_PRINT();
+      M_PSP_EBREAK();
+    }
+  }
+}
+
+/**
+ * @brief - demoStart - startup point of the demo application. called from main function.
+ *
+ */
+void demoStart(void)
+{
+  u32_t uiHartId = M_PSP_MACHINE_GET_HART_ID();
+
+  /* Both harts use the same vector table */
+  pspMachineInterruptsSetVecTableAddress(&M_PSP_VECT_TABLE);
+
+  if (E_HART0 == uiHartId)
+  {
+    M_DEMO_START_PRINT();
+
+    /* Initialize PSP internal mutexs */
+    pspMutexInitPspMutexs();
+
+    /* Initialize the sync points and the mutexs heap */
+    pspMemsetBytes((void*)g_uiDemoSyncPoint, 0, sizeof(g_uiDemoSyncPoint));
+    pspMutexHeapInit(g_stMutexArea, D_DEMO_NUMBER_OF_MUTEXES);
+
+    /* start hart1 */
+    asm volatile ("csrrwi x0, 0x7fc, 3");
+  }
+
+  demoMutexContention(E_PSP_MUTEX_TYPE_TEST_AND_SET, &g_uiDemoSyncPoint[0], "test-and-set");
+  demoMutexContention(E_PSP_MUTEX_TYPE_TICKET, &g_uiDemoSyncPoint[2], "ticket");
+#ifdef D_PSP_MUTEX_QUEUE_LOCK
+  demoMutexContention(E_PSP_MUTEX_TYPE_QUEUE, &g_uiDemoSyncPoint[4], "queue");
+#endif /* D_PSP_MUTEX_QUEUE_LOCK */
+
+  if (E_HART0 == uiHartId)
+  {
+    M_DEMO_END_PRINT();
+  }
+}
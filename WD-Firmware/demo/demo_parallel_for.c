@@ -0,0 +1,197 @@
+/*
+* SPDX-License-Identifier: Apache-2.0
+* Copyright 2026 Western Digital Corporation or its affiliates.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http:*www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/**
+* @file   demo_parallel_for.c
+* @author Western Digital
+* @date   16.10.2026
+* @brief  Demo application for the hart barrier and the parallel-for on EH2.
+*         The dot product of two arrays is calculated by hart0 alone and then split
+*         across both harts with pspParallelFor; hart0 verifies the results match and
+*         prints the cycles of each. The harts then pass the same barrier many times
+*         in a row, to verify it can be reused
+*/
+
+/**
+* include files
+*/
+#include "psp_api.h"
+#include "demo_platform_al.h"
+#include "demo_utils.h"
+
+/**
+* definitions
+*/
+#define D_DEMO_ARRAY_SIZE              2000
+#define D_DEMO_NUM_OF_ROUNDS           1000
+
+/**
+* macros
+*/
+
+/**
+* types
+*/
+typedef enum demoHartNum
+{
+  E_HART0     = 0,
+  E_HART1     = 1,
+  E_LAST_HART,
+} eDemoHartNum_t;
+
+/**
+* local prototypes
+*/
+
+/**
+* external prototypes
+*/
+
+/**
+* global variables
+*/
+u32_t g_uiDemoVecA[D_DEMO_ARRAY_SIZE];
+u32_t g_uiDemoVecB[D_DEMO_ARRAY_SIZE];
+u32_t g_uiDemoSum;
+volatile u32_t g_uiDemoRound[D_PSP_NUM_OF_HARTS];
+
+pspBarrier_t g_stDemoBarrier;
+
+/**
+* APIs
+*/
+
+/**
+ * @brief - Dot product of a chunk of the arrays. The sum of the chunk is added to the
+ *          total atomically
+ */
+void demoDotProduct(u32_t uiFirst, u32_t uiEnd, void* pArg)
+{
+  u32_t uiIndex, uiSum = 0;
+
+  for (uiIndex = uiFirst; uiIndex < uiEnd; uiIndex++)
+  {
+    uiSum += g_uiDemoVecA[uiIndex] * g_uiDemoVecB[uiIndex];
+  }
+
+  M_PSP_ATOMIC_AMO_ADD((u32_t*)pArg, uiSum);
+}
+
+/**
+ * @brief - The dot product on hart0 alone and split across the harts
+ */
+void demoParallelForDotProduct(void)
+{
+  u32_t uiHartId = M_PSP_MACHINE_GET_HART_ID();
+  u32_t uiSerialSum = 0, uiSerialCycles = 0, uiStart = 0;
+
+  if (E_HART0 == uiHartId)
+  {
+    uiStart = M_PSP_READ_CSR(D_PSP_MCYCLE_NUM);
+    demoDotProduct(0, D_DEMO_ARRAY_SIZE, &uiSerialSum);
+    uiSerialCycles = M_PSP_READ_CSR(D_PSP_MCYCLE_NUM) - uiStart;
+    g_uiDemoSum = 0;
+  }
+
+  pspBarrierWait(&g_stDemoBarrier);
+
+  if (E_HART0 == uiHartId)
+  {
+    uiStart = M_PSP_READ_CSR(D_PSP_MCYCLE_NUM);
+  }
+
+  pspParallelFor(&g_stDemoBarrier, 0, D_DEMO_ARRAY_SIZE, demoDotProduct, &g_uiDemoSum);
+
+  if (E_HART0 == uiHartId)
+  {
+    demoOutputMsg("Dot product: 1 hart %d cycles, %d harts %d cycles\n", uiSerialCycles,
+                  M_PSP_MACHINE_GET_NUM_OF_HARTS(), M_PSP_READ_CSR(D_PSP_MCYCLE_NUM) - uiStart);
+    if (uiSerialSum != g_uiDemoSum)
+    {
+      M_DEMO_ERR_PRINT();
+      M_PSP_EBREAK();
+    }
+  }
+}
+
+/**
+ * @brief - Pass the same barrier many times. No hart starts a round before all the
+ *          harts finished the previous one
+ */
+void demoParallelForReuseBarrier(void)
+{
+  u32_t uiHartId = M_PSP_MACHINE_GET_HART_ID();
+  u32_t uiRound, uiHart;
+
+  for (uiRound = 0; uiRound < D_DEMO_NUM_OF_ROUNDS; uiRound++)
+  {
+    g_uiDemoRound[uiHartId] = uiRound;
+    pspBarrierWait(&g_stDemoBarrier);
+
+    for (uiHart = 0; uiHart < M_PSP_MACHINE_GET_NUM_OF_HARTS(); uiHart++)
+    {
+      if (uiRound != g_uiDemoRound[uiHart])
+      {
+        M_DEMO_ERR_PRINT();
+        M_PSP_EBREAK();
+      }
+    }
+
+    pspBarrierWait(&g_stDemoBarrier);
+  }
+}
+
+/**
+ * @brief - demoStart - startup point of the demo application. called from main function.
+ *
+ */
+void demoStart(void)
+{
+  u32_t uiHartId = M_PSP_MACHINE_GET_HART_ID();
+  u32_t uiIndex;
+
+  /* Both harts use the same vector table */
+  pspMachineInterruptsSetVecTableAddress(&M_PSP_VECT_TABLE);
+
+  if (E_HART0 == uiHartId)
+  {
+    M_DEMO_START_PRINT();
+
+    /* Initialize PSP internal mutexs */
+    pspMutexInitPspMutexs();
+
+    for (uiIndex = 0; uiIndex < D_DEMO_ARRAY_SIZE; uiIndex++)
+    {
+      g_uiDemoVecA[uiIndex] = uiIndex;
+      g_uiDemoVecB[uiIndex] = uiIndex * uiIndex;
+    }
+
+    /* The barrier of all the harts of the core */
+    pspBarrierInit(&g_stDemoBarrier, M_PSP_MACHINE_GET_NUM_OF_HARTS());
+
+    /* start hart1 */
+    asm volatile ("csrrwi x0, 0x7fc, 3");
+  }
+
+  demoParallelForDotProduct();
+  demoParallelForReuseBarrier();
+
+  if (E_HART0 == uiHartId)
+  {
+    M_DEMO_END_PRINT();
+  }
+}
@@ -0,0 +1,161 @@
+/*
+* SPDX-License-Identifier: Apache-2.0
+* Copyright 2026 Western Digital Corporation or its affiliates.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http:*www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/**
+* @file   demo_pc_sample.c
+* @author Western Digital
+* @date   16.10.2026
+* @brief  Demo application for the PC-sampling profiler.
+*         A workload with a hot and a cold function is sampled on internal timer0. The
+*         samples are read out of the ring buffer in chunks and printed as "pcs" lines,
+*         which psp/tools/psp_pc_sample_fold.py folds into a flame graph. The demo
+*         verifies that the workload was sampled and that samples were lost only when
+*         the ring buffer was full
+*/
+
+/**
+* include files
+*/
+#include "psp_api.h"
+#include "demo_platform_al.h"
+#include "demo_utils.h"
+
+/**
+* definitions
+*/
+#define D_DEMO_SAMPLE_PERIOD        5000    /* Cycles */
+#define D_DEMO_NUM_OF_RUNS          200
+#define D_DEMO_HOT_ITERATIONS       400
+#define D_DEMO_COLD_ITERATIONS      40
+#define D_DEMO_READ_CHUNK           16
+
+/**
+* macros
+*/
+#define M_DEMO_VERIFY(bCondition)   if (!(bCondition)) \
+                                    { \
+                                      M_DEMO_ERR_PRINT(); \
+                                      M_PSP_EBREAK(); \
+                                    }
+
+/**
+* types
+*/
+
+/**
+* local prototypes
+*/
+
+/**
+* external prototypes
+*/
+
+/**
+* global variables
+*/
+volatile u32_t g_uiDemoSum;
+pspPcSample_t g_stDemoSamples[D_DEMO_READ_CHUNK];
+
+/**
+* APIs
+*/
+
+/**
+ * @brief - Work that takes most of the samples
+ */
+D_PSP_NO_INLINE void demoPcSampleHot(u32_t uiSeed)
+{
+  u32_t uiIndex;
+
+  for (uiIndex = 0; uiIndex < D_DEMO_HOT_ITERATIONS; uiIndex++)
+  {
+    g_uiDemoSum += (uiIndex * uiSeed) ^ (g_uiDemoSum >> 3);
+  }
+}
+
+/**
+ * @brief - Work that takes a few of the samples
+ */
+D_PSP_NO_INLINE void demoPcSampleCold(u32_t uiSeed)
+{
+  u32_t uiIndex;
+
+  for (uiIndex = 0; uiIndex < D_DEMO_COLD_ITERATIONS; uiIndex++)
+  {
+    g_uiDemoSum -= uiIndex + uiSeed;
+  }
+}
+
+/**
+ * @brief - Print the samples in the ring buffer, in chunks
+ *
+ * @return - number of printed samples
+ */
+u32_t demoPcSamplePrint(u32_t* pNumOfLost)
+{
+  u32_t uiNumOfSamples, uiSample, uiNumOfPrinted = 0;
+
+  do
+  {
+    uiNumOfSamples = pspPcSampleRead(g_stDemoSamples, D_DEMO_READ_CHUNK, pNumOfLost);
+    for (uiSample = 0; uiSample < uiNumOfSamples; uiSample++)
+    {
+      M_DEMO_VERIFY(0 != g_stDemoSamples[uiSample].uiPc);
+      demoOutputMsg("pcs %x %x %x %x\n", g_stDemoSamples[uiSample].uiHartId, g_stDemoSamples[uiSample].uiContext,
+                    g_stDemoSamples[uiSample].uiPc, g_stDemoSamples[uiSample].uiRa);
+    }
+    uiNumOfPrinted += uiNumOfSamples;
+  } while (0 != uiNumOfSamples);
+
+  return uiNumOfPrinted;
+}
+
+/**
+ * @brief - demoStart - startup point of the demo application. called from main function.
+ *
+ */
+void demoStart(void)
+{
+  u32_t uiRun, uiNumOfPrinted, uiNumOfLost, uiInterruptsState;
+
+  M_DEMO_START_PRINT();
+
+  /* Register interrupt vector */
+  pspMachineInterruptsSetVecTableAddress(&M_PSP_VECT_TABLE);
+
+  pspMachineInterruptsEnable();
+  pspPcSampleStart(D_PSP_INTERNAL_TIMER0, D_DEMO_SAMPLE_PERIOD, NULL);
+
+  for (uiRun = 0; uiRun < D_DEMO_NUM_OF_RUNS; uiRun++)
+  {
+    demoPcSampleHot(uiRun);
+    demoPcSampleCold(uiRun);
+  }
+
+  pspPcSampleStop();
+  pspMachineInterruptsDisable(&uiInterruptsState);
+
+  uiNumOfPrinted = demoPcSamplePrint(&uiNumOfLost);
+
+  /* The workload was sampled, and samples were lost only when the ring buffer was full */
+  M_DEMO_VERIFY(0 != uiNumOfPrinted);
+  M_DEMO_VERIFY(uiNumOfPrinted <= D_PSP_PC_SAMPLE_BUFFER_SIZE);
+  M_DEMO_VERIFY((0 == uiNumOfLost) || (D_PSP_PC_SAMPLE_BUFFER_SIZE == uiNumOfPrinted));
+  demoOutputMsg("%d samples printed, %d lost\n", uiNumOfPrinted, uiNumOfLost);
+
+  M_DEMO_END_PRINT();
+}
@@ -0,0 +1,152 @@
+/*
+* SPDX-License-Identifier: Apache-2.0
+* Copyright 2026 Western Digital Corporation or its affiliates.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http:*www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/**
+* @file   demo_pmu_mux.c
+* @author Western Digital
+* @date   16.10.2026
+* @brief  Demo application for the PMU event multiplexer.
+*         Collect all the events of the core over a single run of a workload, with the
+*         groups rotated on internal timer0. Verify that every group was on the counters,
+*         that the enabled cycles of the groups add up to the run and that the committed
+*         instructions are estimated, and print the full event vector
+*/
+
+/**
+* include files
+*/
+#include "psp_api.h"
+#include "demo_platform_al.h"
+#include "demo_utils.h"
+
+/**
+* definitions
+*/
+#define D_DEMO_ROTATION_PERIOD      10000   /* Cycles */
+#define D_DEMO_NUM_OF_ROUNDS        4       /* Each group is on the counters at least this many times */
+#define D_DEMO_WORK_SIZE            64
+
+/**
+* macros
+*/
+#define M_DEMO_VERIFY(bCondition)   if (!(bCondition)) \
+                                    { \
+                                      M_DEMO_ERR_PRINT(); \
+                                      M_PSP_EBREAK(); \
+                                    }
+
+/**
+* types
+*/
+
+/**
+* local prototypes
+*/
+
+/**
+* external prototypes
+*/
+
+/**
+* global variables
+*/
+pspPmuMuxResult_t g_stDemoResults[D_PSP_PMU_MUX_MAX_EVENTS];
+u32_t g_uiDemoWork[D_DEMO_WORK_SIZE];
+
+/**
+* APIs
+*/
+
+/**
+ * @brief - Workload with loads, stores, multiplications, divisions and branches
+ */
+void demoPmuMuxWork(u32_t uiSeed)
+{
+  u32_t uiIndex;
+
+  for (uiIndex = 0; uiIndex < D_DEMO_WORK_SIZE; uiIndex++)
+  {
+    if (0 != (uiIndex & uiSeed & 0x1))
+    {
+      g_uiDemoWork[uiIndex] += (uiIndex * uiSeed) / (uiIndex + 1);
+    }
+    else
+    {
+      g_uiDemoWork[uiIndex] ^= g_uiDemoWork[(uiIndex + uiSeed) % D_DEMO_WORK_SIZE];
+    }
+  }
+}
+
+/**
+ * @brief - demoStart - startup point of the demo application. called from main function.
+ *
+ */
+void demoStart(void)
+{
+  u32_t uiNumOfEvents, uiNumOfGroups, uiResult, uiSeed = 0;
+  u64_t udTotalCycles, udEnabledCycles = 0;
+  u64_t udRunCycles;
+
+  M_DEMO_START_PRINT();
+
+  /* Register interrupt vector */
+  pspMachineInterruptsSetVecTableAddress(&M_PSP_VECT_TABLE);
+
+  /* All the events of the core */
+  uiNumOfEvents = pspPmuMuxInit(NULL, 0);
+  uiNumOfGroups = (uiNumOfEvents + D_PSP_PMU_MUX_GROUP_SIZE - 1) / D_PSP_PMU_MUX_GROUP_SIZE;
+
+  pspMachineInterruptsEnable();
+  pspPmuMuxStart(D_PSP_INTERNAL_TIMER0, D_DEMO_ROTATION_PERIOD);
+
+  udRunCycles = pspMachinePerfCounterGet(D_PSP_CYCLE_COUNTER);
+  while ((pspMachinePerfCounterGet(D_PSP_CYCLE_COUNTER) - udRunCycles) <
+         ((u64_t)uiNumOfGroups * D_DEMO_NUM_OF_ROUNDS * D_DEMO_ROTATION_PERIOD))
+  {
+    demoPmuMuxWork(uiSeed++);
+  }
+
+  pspPmuMuxStop();
+  pspMachineInterruptsDisable(&uiResult);
+
+  M_DEMO_VERIFY(uiNumOfEvents == pspPmuMuxGetResults(g_stDemoResults, D_PSP_PMU_MUX_MAX_EVENTS, &udTotalCycles));
+
+  demoOutputMsg("%d events in %d groups, %d cycles\n", uiNumOfEvents, uiNumOfGroups, (u32_t)udTotalCycles);
+  for (uiResult = 0; uiResult < uiNumOfEvents; uiResult++)
+  {
+    /* Every group was on the counters */
+    M_DEMO_VERIFY(0 != g_stDemoResults[uiResult].udEnabledCycles);
+    M_DEMO_VERIFY(g_stDemoResults[uiResult].udScaledCount >= g_stDemoResults[uiResult].udCount);
+    if (0 == (uiResult % D_PSP_PMU_MUX_GROUP_SIZE))
+    {
+      udEnabledCycles += g_stDemoResults[uiResult].udEnabledCycles;
+    }
+
+    demoOutputMsg("event %d: count %d, enabled %d cycles, scaled %d\n", g_stDemoResults[uiResult].uiEvent,
+                  (u32_t)g_stDemoResults[uiResult].udCount, (u32_t)g_stDemoResults[uiResult].udEnabledCycles,
+                  (u32_t)g_stDemoResults[uiResult].udScaledCount);
+  }
+
+  /* The groups took turns - their enabled cycles add up to the run */
+  M_DEMO_VERIFY(udEnabledCycles == udTotalCycles);
+
+  /* The workload commits instructions all the time - the estimate is not 0 */
+  M_DEMO_VERIFY(D_INSTR_COMMITTED_ALL == g_stDemoResults[D_INSTR_COMMITTED_ALL - 1].uiEvent);
+  M_DEMO_VERIFY(0 != g_stDemoResults[D_INSTR_COMMITTED_ALL - 1].udScaledCount);
+
+  M_DEMO_END_PRINT();
+}
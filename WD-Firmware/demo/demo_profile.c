@@ -0,0 +1,198 @@
+/*
+* SPDX-License-Identifier: Apache-2.0
+* Copyright 2026 Western Digital Corporation or its affiliates.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http:*www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/**
+* @file   demo_profile.c
+* @author Western Digital
+* @date   16.10.2026
+* @brief  Demo application for the PSP region profiling.
+*         (1) Profile an outer region that runs an inner region several times and verify
+*             the run counts and that the outer region counts the inner regions
+*         (2) Verify that regions deeper than D_PSP_PROFILE_MAX_DEPTH are not measured
+*         (3) Print the statistics of the regions and the cost of an empty region
+*/
+
+/**
+* include files
+*/
+#include "psp_api.h"
+#include "demo_platform_al.h"
+#include "demo_utils.h"
+
+/**
+* definitions
+*/
+#define D_DEMO_NUM_OF_INNER_RUNS    10
+#define D_DEMO_NUM_OF_ITERATIONS    100
+
+/* Region-ids */
+#define D_DEMO_REGION_OUTER         0
+#define D_DEMO_REGION_INNER         1
+#define D_DEMO_REGION_EMPTY         2
+#define D_DEMO_REGION_NESTED        3
+
+/**
+* macros
+*/
+#define M_DEMO_VERIFY(bCondition)   if (!(bCondition)) \
+                                    { \
+                                      M_DEMO_ERR_PRINT(); \
+                                      M_PSP_EBREAK(); \
+                                    }
+
+/**
+* types
+*/
+
+/**
+* local prototypes
+*/
+
+/**
+* external prototypes
+*/
+
+/**
+* global variables
+*/
+volatile u32_t g_uiDemoSum;
+
+/**
+* APIs
+*/
+
+/**
+ * @brief - Some work with branches for the inner region
+ */
+void demoProfileWork(u32_t uiSeed)
+{
+  u32_t uiIndex;
+
+  for (uiIndex = 0; uiIndex < D_DEMO_NUM_OF_ITERATIONS; uiIndex++)
+  {
+    if (0 != ((uiIndex * uiSeed) & 0x4))
+    {
+      g_uiDemoSum += uiIndex;
+    }
+    else
+    {
+      g_uiDemoSum -= uiSeed;
+    }
+  }
+}
+
+/**
+ * @brief - Print the statistics of a region
+ */
+void demoProfilePrint(const char* pRegionName, pspProfileStats_t* pStats)
+{
+  pspProfileMeasure_t* pCycles = &pStats->stCounter[D_PSP_PROFILE_CYCLES];
+  pspProfileMeasure_t* pInstret = &pStats->stCounter[D_PSP_PROFILE_INSTRET];
+
+  demoOutputMsg("%s: %d runs, cycles min %d max %d total %d, instret total %d\n", pRegionName,
+                pStats->uiCount, pCycles->uiMin, pCycles->uiMax, (u32_t)pCycles->udTotal, (u32_t)pInstret->udTotal);
+  demoOutputMsg("  branches %d, mispredicted %d, i-cache misses %d, d-bus stalls %d\n",
+                (u32_t)pStats->stCounter[D_PSP_PROFILE_EVENT0].udTotal, (u32_t)pStats->stCounter[D_PSP_PROFILE_EVENT1].udTotal,
+                (u32_t)pStats->stCounter[D_PSP_PROFILE_EVENT2].udTotal, (u32_t)pStats->stCounter[D_PSP_PROFILE_EVENT3].udTotal);
+}
+
+/**
+ * @brief - Profile an outer region that runs an inner region several times
+ */
+void demoProfileNesting(void)
+{
+  pspProfileStats_t stOuter, stInner;
+  u32_t uiRun;
+
+  M_PSP_PROFILE_BEGIN(D_DEMO_REGION_OUTER);
+  for (uiRun = 0; uiRun < D_DEMO_NUM_OF_INNER_RUNS; uiRun++)
+  {
+    M_PSP_PROFILE_BEGIN(D_DEMO_REGION_INNER);
+    demoProfileWork(uiRun);
+    M_PSP_PROFILE_END(D_DEMO_REGION_INNER);
+  }
+  M_PSP_PROFILE_END(D_DEMO_REGION_OUTER);
+
+  M_DEMO_VERIFY(1 == pspProfileGetStats(D_DEMO_REGION_OUTER, &stOuter));
+  M_DEMO_VERIFY(D_DEMO_NUM_OF_INNER_RUNS == pspProfileGetStats(D_DEMO_REGION_INNER, &stInner));
+
+  /* The outer region counts the inner regions */
+  M_DEMO_VERIFY(stOuter.stCounter[D_PSP_PROFILE_CYCLES].udTotal > stInner.stCounter[D_PSP_PROFILE_CYCLES].udTotal);
+  M_DEMO_VERIFY(stOuter.stCounter[D_PSP_PROFILE_INSTRET].udTotal > stInner.stCounter[D_PSP_PROFILE_INSTRET].udTotal);
+  M_DEMO_VERIFY(stOuter.stCounter[D_PSP_PROFILE_EVENT0].udTotal >= stInner.stCounter[D_PSP_PROFILE_EVENT0].udTotal);
+  M_DEMO_VERIFY(stInner.stCounter[D_PSP_PROFILE_CYCLES].uiMin <= stInner.stCounter[D_PSP_PROFILE_CYCLES].uiMax);
+  /* Each inner run takes a branch per iteration */
+  M_DEMO_VERIFY(stInner.stCounter[D_PSP_PROFILE_EVENT0].uiMin >= D_DEMO_NUM_OF_ITERATIONS);
+
+  demoProfilePrint("outer", &stOuter);
+  demoProfilePrint("inner", &stInner);
+}
+
+/**
+ * @brief - Nest regions one level deeper than D_PSP_PROFILE_MAX_DEPTH. Only the regions
+ *          within the maximal depth are measured
+ */
+void demoProfileDepth(u32_t uiDepth)
+{
+  M_PSP_PROFILE_BEGIN(D_DEMO_REGION_NESTED);
+  if (uiDepth < D_PSP_PROFILE_MAX_DEPTH)
+  {
+    demoProfileDepth(uiDepth + 1);
+  }
+  M_PSP_PROFILE_END(D_DEMO_REGION_NESTED);
+}
+
+/**
+ * @brief - Print the cost of an empty region - the counts added to a region by profiling
+ */
+void demoProfileOverhead(void)
+{
+  pspProfileStats_t stEmpty;
+  u32_t uiRun;
+
+  for (uiRun = 0; uiRun < D_DEMO_NUM_OF_INNER_RUNS; uiRun++)
+  {
+    M_PSP_PROFILE_BEGIN(D_DEMO_REGION_EMPTY);
+    M_PSP_PROFILE_END(D_DEMO_REGION_EMPTY);
+  }
+
+  M_DEMO_VERIFY(D_DEMO_NUM_OF_INNER_RUNS == pspProfileGetStats(D_DEMO_REGION_EMPTY, &stEmpty));
+  demoOutputMsg("empty region: %d cycles, %d instructions\n",
+                stEmpty.stCounter[D_PSP_PROFILE_CYCLES].uiMin, stEmpty.stCounter[D_PSP_PROFILE_INSTRET].uiMin);
+}
+
+/**
+ * @brief - demoStart - startup point of the demo application. called from main function.
+ *
+ */
+void demoStart(void)
+{
+  pspProfileStats_t stNested;
+
+  M_DEMO_START_PRINT();
+
+  pspProfileInit(D_BRANCHES_COMMITTED, D_BRANCHES_MISPREDICTED, D_I_CACHE_MISSES, D_CYCLES_STALLED_DUE_TO_D_BUS_BUSY);
+
+  demoProfileNesting();
+
+  demoProfileDepth(0);
+  M_DEMO_VERIFY(D_PSP_PROFILE_MAX_DEPTH == pspProfileGetStats(D_DEMO_REGION_NESTED, &stNested));
+
+  demoProfileOverhead();
+
+  M_DEMO_END_PRINT();
+}
@@ -0,0 +1,228 @@
+/*
+* SPDX-License-Identifier: Apache-2.0
+* Copyright 2026 Western Digital Corporation or its affiliates.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http:*www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/**
+* @file   demo_ring_buffer.c
+* @author Western Digital
+* @date   16.10.2026
+* @brief  Demo application for the lock-free inter-hart ring buffers on EH2.
+*         Hart0 produces messages and hart1 consumes them, through a SPSC ring and
+*         then through a MPSC ring that hart1 also produces to. For each ring the
+*         demo verifies the order of the messages of each producer and prints the
+*         throughput (cycles per message) measured by hart1
+*/
+
+/**
+* include files
+*/
+#include "psp_api.h"
+#include "demo_platform_al.h"
+#include "demo_utils.h"
+
+/**
+* definitions
+*/
+#define D_DEMO_NUMBER_OF_HARTS         2
+#define D_DEMO_NUM_OF_MESSAGES         10000
+#define D_DEMO_RING_SIZE               32
+#define D_DEMO_PRODUCER_SHIFT          24   /* The producer hart id is carried in the message upper bits */
+#define D_DEMO_SEQUENCE_MASK           0x00FFFFFF
+
+/* Sync points */
+#define D_DEMO_SYNC_SPSC_START         0
+#define D_DEMO_SYNC_SPSC_END           1
+#define D_DEMO_SYNC_MPSC_START         2
+#define D_DEMO_SYNC_MPSC_END           3
+#define D_DEMO_NUM_OF_SYNC_POINTS      4
+
+/**
+* macros
+*/
+#define M_DEMO_MESSAGE(uiHartId, uiSequence)   (((uiHartId) << D_DEMO_PRODUCER_SHIFT) | (uiSequence))
+
+/**
+* types
+*/
+typedef enum demoHartNum
+{
+  E_HART0     = 0,
+  E_HART1     = 1,
+  E_LAST_HART,
+} eDemoHartNum_t;
+
+/**
+* local prototypes
+*/
+
+/**
+* external prototypes
+*/
+
+/**
+* global variables
+*/
+pspRingSpsc_t g_stDemoSpscRing;
+u32_t g_uiDemoSpscBuffer[D_DEMO_RING_SIZE];
+pspRingMpsc_t g_stDemoMpscRing;
+pspRingSlot_t g_stDemoMpscSlots[D_DEMO_RING_SIZE];
+
+u32_t g_uiDemoSyncPoint[D_DEMO_NUM_OF_SYNC_POINTS];
+
+/**
+* APIs
+*/
+
+/**
+ * @brief - Each hart spins here on a global synchronization point, to make sure both harts
+ *          start the next activity, following this function, simultaneously
+ */
+void demoRingSpinOnSyncPoint(volatile u32_t* pSyncPoint)
+{
+  M_PSP_ATOMIC_AMO_ADD((u32_t*)pSyncPoint, 1);
+  while (D_DEMO_NUMBER_OF_HARTS > *pSyncPoint){};
+}
+
+/**
+ * @brief - Report the throughput of a ring
+ */
+void demoRingReport(const char* pRingName, u32_t uiCycles, u32_t uiNumOfMessages)
+{
+  demoOutputMsg("%s ring: %d messages, %d cycles, %d cycles per message\n",
+                pRingName, uiNumOfMessages, uiCycles, uiCycles / uiNumOfMessages);
+}
+
+/**
+ * @brief - Hart0 pushes messages to a SPSC ring and hart1 pops them
+ */
+void demoRingSpsc(void)
+{
+  u32_t uiHartId = M_PSP_MACHINE_GET_HART_ID();
+  u32_t uiSequence, uiMessage, uiStart;
+
+  demoRingSpinOnSyncPoint(&g_uiDemoSyncPoint[D_DEMO_SYNC_SPSC_START]);
+
+  if (E_HART0 == uiHartId)
+  {
+    for (uiSequence = 0; uiSequence < D_DEMO_NUM_OF_MESSAGES; uiSequence++)
+    {
+      while (D_PSP_SUCCESS != pspRingSpscPush(&g_stDemoSpscRing, uiSequence)){};
+    }
+  }
+  else
+  {
+    uiStart = M_PSP_READ_CSR(D_PSP_MCYCLE_NUM);
+    for (uiSequence = 0; uiSequence < D_DEMO_NUM_OF_MESSAGES; uiSequence++)
+    {
+      while (D_PSP_SUCCESS != pspRingSpscPop(&g_stDemoSpscRing, &uiMessage)){};
+      /* The messages are received in the order they were sent */
+      if (uiSequence != uiMessage)
+      {
+        M_DEMO_ERR_PRINT();
+        M_PSP_EBREAK();
+      }
+    }
+    demoRingReport("SPSC", M_PSP_READ_CSR(D_PSP_MCYCLE_NUM) - uiStart, D_DEMO_NUM_OF_MESSAGES);
+  }
+
+  demoRingSpinOnSyncPoint(&g_uiDemoSyncPoint[D_DEMO_SYNC_SPSC_END]);
+}
+
+/**
+ * @brief - Both harts push messages to a MPSC ring and hart1 pops them
+ */
+void demoRingMpsc(void)
+{
+  u32_t uiHartId = M_PSP_MACHINE_GET_HART_ID();
+  u32_t uiSent = 0, uiReceived = 0, uiMessage, uiProducer, uiStart;
+  u32_t uiExpected[D_DEMO_NUMBER_OF_HARTS] = { 0 };
+
+  demoRingSpinOnSyncPoint(&g_uiDemoSyncPoint[D_DEMO_SYNC_MPSC_START]);
+
+  if (E_HART0 == uiHartId)
+  {
+    for (uiSent = 0; uiSent < D_DEMO_NUM_OF_MESSAGES; uiSent++)
+    {
+      while (D_PSP_SUCCESS != pspRingMpscPush(&g_stDemoMpscRing, M_DEMO_MESSAGE(E_HART0, uiSent))){};
+    }
+  }
+  else
+  {
+    uiStart = M_PSP_READ_CSR(D_PSP_MCYCLE_NUM);
+    while ((D_DEMO_NUMBER_OF_HARTS * D_DEMO_NUM_OF_MESSAGES) > uiReceived)
+    {
+      /* Hart1 is a producer too */
+      if ((D_DEMO_NUM_OF_MESSAGES > uiSent) &&
+          (D_PSP_SUCCESS == pspRingMpscPush(&g_stDemoMpscRing, M_DEMO_MESSAGE(E_HART1, uiSent))))
+      {
+        uiSent++;
+      }
+
+      if (D_PSP_SUCCESS == pspRingMpscPop(&g_stDemoMpscRing, &uiMessage))
+      {
+        /* The messages of each producer are received in the order they were sent */
+        uiProducer = uiMessage >> D_DEMO_PRODUCER_SHIFT;
+        if ((D_DEMO_NUMBER_OF_HARTS <= uiProducer) ||
+            (uiExpected[uiProducer] != (uiMessage & D_DEMO_SEQUENCE_MASK)))
+        {
+          M_DEMO_ERR_PRINT();
+          M_PSP_EBREAK();
+        }
+        uiExpected[uiProducer]++;
+        uiReceived++;
+      }
+    }
+    demoRingReport("MPSC", M_PSP_READ_CSR(D_PSP_MCYCLE_NUM) - uiStart, uiReceived);
+  }
+
+  demoRingSpinOnSyncPoint(&g_uiDemoSyncPoint[D_DEMO_SYNC_MPSC_END]);
+}
+
+/**
+ * @brief - demoStart - startup point of the demo application. called from main function.
+ *
+ */
+void demoStart(void)
+{
+  u32_t uiHartId = M_PSP_MACHINE_GET_HART_ID();
+
+  /* Both harts use the same vector table */
+  pspMachineInterruptsSetVecTableAddress(&M_PSP_VECT_TABLE);
+
+  if (E_HART0 == uiHartId)
+  {
+    M_DEMO_START_PRINT();
+
+    /* Initialize PSP internal mutexs */
+    pspMutexInitPspMutexs();
+
+    /* Initialize the sync points and the rings */
+    pspMemsetBytes((void*)g_uiDemoSyncPoint, 0, sizeof(g_uiDemoSyncPoint));
+    pspRingSpscInit(&g_stDemoSpscRing, g_uiDemoSpscBuffer, D_DEMO_RING_SIZE);
+    pspRingMpscInit(&g_stDemoMpscRing, g_stDemoMpscSlots, D_DEMO_RING_SIZE);
+
+    /* start hart1 */
+    asm volatile ("csrrwi x0, 0x7fc, 3");
+  }
+
+  demoRingSpsc();
+  demoRingMpsc();
+
+  if (E_HART0 == uiHartId)
+  {
+    M_DEMO_END_PRINT();
+  }
+}
@@ -0,0 +1,259 @@
+/*
+* SPDX-License-Identifier: Apache-2.0
+* Copyright 2026 Western Digital Corporation or its affiliates.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http:*www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/**
+* @file   demo_rw_lock.c
+* @author Western Digital
+* @date   16.10.2026
+* @brief  Demo application for the reader-writer lock, the sequence lock and the
+*         64-bit counter on EH2.
+*         Both harts look up a shared table, and hart0 updates it once in a while.
+*         The lookups are done under an exclusive mutex and then under a reader-writer
+*         lock; hart1 prints the cycles per lookup of each. Both harts also count
+*         their lookups in a 64-bit counter that hart1 reads along the way
+*/
+
+/**
+* include files
+*/
+#include "psp_api.h"
+#include "demo_platform_al.h"
+#include "demo_utils.h"
+
+/**
+* definitions
+*/
+#define D_DEMO_NUMBER_OF_HARTS         2
+#define D_DEMO_NUMBER_OF_MUTEXES       1
+#define D_DEMO_NUM_OF_LOOKUPS          5000
+#define D_DEMO_UPDATE_PERIOD           64    /* Hart0 updates the table every D_DEMO_UPDATE_PERIOD lookups */
+#define D_DEMO_TABLE_SIZE              8
+#define D_DEMO_COUNTER_STEP            0x10000000  /* The counter crosses 32 bits during the demo */
+
+/* Sync points */
+#define D_DEMO_SYNC_MUTEX_START        0
+#define D_DEMO_SYNC_MUTEX_END          1
+#define D_DEMO_SYNC_RW_START           2
+#define D_DEMO_SYNC_RW_END             3
+#define D_DEMO_NUM_OF_SYNC_POINTS      4
+
+/**
+* macros
+*/
+
+/**
+* types
+*/
+typedef enum demoHartNum
+{
+  E_HART0     = 0,
+  E_HART1     = 1,
+  E_LAST_HART,
+} eDemoHartNum_t;
+
+/* The lock used for the table lookups */
+typedef enum demoLockType
+{
+  E_DEMO_LOCK_MUTEX = 0,
+  E_DEMO_LOCK_RW    = 1,
+} eDemoLockType_t;
+
+/**
+* local prototypes
+*/
+
+/**
+* external prototypes
+*/
+
+/**
+* global variables
+*/
+pspMutexCb_t g_stMutexArea[D_DEMO_NUMBER_OF_MUTEXES];
+pspMutexCb_t* g_pDemoMutex = NULL;
+pspMutexRw_t g_stDemoRwLock;
+pspMutexCounter64_t g_stDemoLookups;
+
+/* Shared table. All the entries hold the same generation - a lookup that sees two generations is torn */
+volatile u32_t g_uiDemoTable[D_DEMO_TABLE_SIZE];
+
+u32_t g_uiDemoSyncPoint[D_DEMO_NUM_OF_SYNC_POINTS];
+
+/**
+* APIs
+*/
+
+/**
+ * @brief - Each hart spins here on a global synchronization point, to make sure both harts
+ *          start the next activity, following this function, simultaneously
+ */
+void demoRwSpinOnSyncPoint(volatile u32_t* pSyncPoint)
+{
+  M_PSP_ATOMIC_AMO_ADD((u32_t*)pSyncPoint, 1);
+  while (D_DEMO_NUMBER_OF_HARTS > *pSyncPoint){};
+}
+
+/**
+ * @brief - Look up the table. All the entries must belong to the same update
+ */
+void demoRwLookup(void)
+{
+  u32_t uiIndex;
+  u32_t uiGeneration = g_uiDemoTable[0];
+
+  for (uiIndex = 1; uiIndex < D_DEMO_TABLE_SIZE; uiIndex++)
+  {
+    if (uiGeneration != g_uiDemoTable[uiIndex])
+    {
+      M_DEMO_ERR_PRINT();
+      M_PSP_EBREAK();
+    }
+  }
+}
+
+/**
+ * @brief - Update all the entries of the table to the next generation
+ */
+void demoRwUpdate(void)
+{
+  u32_t uiIndex;
+  u32_t uiGeneration = g_uiDemoTable[0] + 1;
+
+  for (uiIndex = 0; uiIndex < D_DEMO_TABLE_SIZE; uiIndex++)
+  {
+    g_uiDemoTable[uiIndex] = uiGeneration;
+  }
+}
+
+/**
+ * @brief - Both harts look up the table under the given lock, and hart0 updates it
+ *          once in a while. Hart1 measures the cycles per lookup
+ */
+void demoRwRun(eDemoLockType_t eLockType, u32_t* pStartSyncPoint, u32_t* pEndSyncPoint)
+{
+  u32_t uiHartId = M_PSP_MACHINE_GET_HART_ID();
+  u32_t uiLookup, uiStart = 0;
+  u64_t udPrevLookups = 0, udLookups;
+
+  demoRwSpinOnSyncPoint(pStartSyncPoint);
+
+  if (E_HART1 == uiHartId)
+  {
+    uiStart = M_PSP_READ_CSR(D_PSP_MCYCLE_NUM);
+  }
+
+  for (uiLookup = 0; uiLookup < D_DEMO_NUM_OF_LOOKUPS; uiLookup++)
+  {
+    if ((E_HART0 == uiHartId) && (0 == (uiLookup % D_DEMO_UPDATE_PERIOD)))
+    {
+      if (E_DEMO_LOCK_MUTEX == eLockType)
+      {
+        pspMutexAtomicLock(g_pDemoMutex);
+        demoRwUpdate();
+        pspMutexAtomicUnlock(g_pDemoMutex);
+      }
+      else
+      {
+        pspMutexRwWriteLock(&g_stDemoRwLock);
+        demoRwUpdate();
+        pspMutexRwWriteUnlock(&g_stDemoRwLock);
+      }
+    }
+
+    if (E_DEMO_LOCK_MUTEX == eLockType)
+    {
+      pspMutexAtomicLock(g_pDemoMutex);
+      demoRwLookup();
+      pspMutexAtomicUnlock(g_pDemoMutex);
+    }
+    else
+    {
+      pspMutexRwReadLock(&g_stDemoRwLock);
+      demoRwLookup();
+      pspMutexRwReadUnlock(&g_stDemoRwLock);
+    }
+
+    pspMutexCounter64Add(&g_stDemoLookups, D_DEMO_COUNTER_STEP);
+
+    /* The counter only grows, and is never read torn */
+    if (E_HART1 == uiHartId)
+    {
+      udLookups = pspMutexCounter64Read(&g_stDemoLookups);
+      if (udLookups < udPrevLookups)
+      {
+        M_DEMO_ERR_PRINT();
+        M_PSP_EBREAK();
+      }
+      udPrevLookups = udLookups;
+    }
+  }
+
+  if (E_HART1 == uiHartId)
+  {
+    demoOutputMsg("%s: %d cycles per lookup\n", (E_DEMO_LOCK_MUTEX == eLockType) ? "mutex" : "rw lock",
+                  (M_PSP_READ_CSR(D_PSP_MCYCLE_NUM) - uiStart) / D_DEMO_NUM_OF_LOOKUPS);
+  }
+
+  demoRwSpinOnSyncPoint(pEndSyncPoint);
+}
+
+/**
+ * @brief - demoStart - startup point of the demo application. called from main function.
+ *
+ */
+void demoStart(void)
+{
+  u32_t uiHartId = M_PSP_MACHINE_GET_HART_ID();
+
+  /* Both harts use the same vector table */
+  pspMachineInterruptsSetVecTableAddress(&M_PSP_VECT_TABLE);
+
+  if (E_HART0 == uiHartId)
+  {
+    M_DEMO_START_PRINT();
+
+    /* Initialize PSP internal mutexs */
+    pspMutexInitPspMutexs();
+
+    /* Initialize the mutexs heap, the locks and the table */
+    pspMutexHeapInit(g_stMutexArea, D_DEMO_NUMBER_OF_MUTEXES);
+    g_pDemoMutex = pspMutexCreate();
+    pspMutexRwInit(&g_stDemoRwLock);
+    pspMutexCounter64Init(&g_stDemoLookups);
+    pspMemsetBytes((void*)g_uiDemoTable, 0, sizeof(g_uiDemoTable));
+    pspMemsetBytes((void*)g_uiDemoSyncPoint, 0, sizeof(g_uiDemoSyncPoint));
+
+    /* start hart1 */
+    asm volatile ("csrrwi x0, 0x7fc, 3");
+  }
+
+  demoRwRun(E_DEMO_LOCK_MUTEX, &g_uiDemoSyncPoint[D_DEMO_SYNC_MUTEX_START], &g_uiDemoSyncPoint[D_DEMO_SYNC_MUTEX_END]);
+  demoRwRun(E_DEMO_LOCK_RW, &g_uiDemoSyncPoint[D_DEMO_SYNC_RW_START], &g_uiDemoSyncPoint[D_DEMO_SYNC_RW_END]);
+
+  if (E_HART0 == uiHartId)
+  {
+    /* Both harts counted all their lookups in both runs */
+    if (pspMutexCounter64Read(&g_stDemoLookups) !=
+        (u64_t)D_DEMO_COUNTER_STEP * D_DEMO_NUMBER_OF_HARTS * D_DEMO_NUM_OF_LOOKUPS * 2)
+    {
+      M_DEMO_ERR_PRINT();
+      M_PSP_EBREAK();
+    }
+
+    M_DEMO_END_PRINT();
+  }
+}
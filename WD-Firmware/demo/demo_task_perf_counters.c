@@ -0,0 +1,238 @@
+/*
+* SPDX-License-Identifier: Apache-2.0
+* Copyright 2026 Western Digital Corporation or its affiliates.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http:*www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/**
+* @file   demo_task_perf_counters.c
+* @author Western Digital
+* @date   16.10.2026
+* @brief  Demo application for the RTOSAL per-task performance counters.
+*         A busy task and a light task, that sleeps most of the time, share the core. A
+*         monitor task wakes up periodically, verifies that the busy task accumulated more
+*         cycles and instructions than the light task and that the cycles of all the tasks
+*         do not exceed the cycles of the run, and prints the counters of the tasks
+*/
+
+/**
+* include files
+*/
+#include "common_types.h"
+#include "rtosal_task_api.h"
+#include "rtosal_time_api.h"
+#include "psp_api.h"
+#include "demo_platform_al.h"
+#include "demo_utils.h"
+
+/**
+* definitions
+*/
+#define D_DEMO_TASK_STACK_SIZE        450
+#define D_DEMO_MONITOR_PERIOD_TICKS   (100/D_TICK_TIME_MS)
+#define D_DEMO_NUM_OF_PERIODS         4
+#define D_DEMO_WORK_SIZE              32
+
+/**
+* macros
+*/
+#define M_DEMO_VERIFY(bCondition)   if (!(bCondition)) \
+                                    { \
+                                      M_DEMO_ERR_PRINT(); \
+                                      M_PSP_EBREAK(); \
+                                    }
+
+/**
+* types
+*/
+
+/**
+* local prototypes
+*/
+static void demoTaskPerfCreateTasks(void *pParameters);
+static void demoTaskPerfBusyTask(void *pParameters);
+static void demoTaskPerfLightTask(void *pParameters);
+static void demoTaskPerfMonitorTask(void *pParameters);
+
+/**
+* external prototypes
+*/
+
+/**
+* global variables
+*/
+static rtosalTask_t stBusyTask;
+static rtosalTask_t stLightTask;
+static rtosalTask_t stMonitorTask;
+static rtosalStackType_t uiBusyTaskStackBuffer[D_DEMO_TASK_STACK_SIZE];
+static rtosalStackType_t uiLightTaskStackBuffer[D_DEMO_TASK_STACK_SIZE];
+static rtosalStackType_t uiMonitorTaskStackBuffer[D_DEMO_TASK_STACK_SIZE];
+static u64_t udDemoStartCycles;
+static volatile u32_t uiDemoWork[D_DEMO_WORK_SIZE];
+
+/**
+* functions
+*/
+
+/**
+ * demoStart - startup point of the demo application. called from main function.
+ *
+ */
+void demoStart(void)
+{
+  M_DEMO_START_PRINT();
+
+  rtosalStart(demoTaskPerfCreateTasks);
+}
+
+/**
+ * demoTaskPerfCreateTasks - program the event counters and create the tasks. Called from
+ *                           RTOS abstraction layer before the scheduler is kicked on
+ *
+ */
+static void demoTaskPerfCreateTasks(void *pParameters)
+{
+  u32_t uiResult;
+
+  /* Disable the timer interrupts until setup is done. */
+  pspMachineInterruptsDisableIntNumber(D_PSP_INTERRUPTS_MACHINE_TIMER);
+
+  pspMachinePerfCounterSet(D_PSP_COUNTER0, D_BRANCHES_COMMITTED);
+  pspMachinePerfCounterSet(D_PSP_COUNTER1, D_BRANCHES_MISPREDICTED);
+  pspMachinePerfCounterSet(D_PSP_COUNTER2, D_MULS_COMMITTED);
+  pspMachinePerfCounterSet(D_PSP_COUNTER3, D_I_CACHE_MISSES);
+  pspMachinePerfMonitorEnableAll();
+
+  uiResult = rtosalTaskCreate(&stMonitorTask, (s08_t*)"MONITOR", E_RTOSAL_PRIO_28,
+                              demoTaskPerfMonitorTask, (u32_t)NULL, D_DEMO_TASK_STACK_SIZE,
+                              uiMonitorTaskStackBuffer, 0, D_RTOSAL_AUTO_START, 0);
+  M_DEMO_VERIFY(D_RTOSAL_SUCCESS == uiResult);
+
+  uiResult = rtosalTaskCreate(&stLightTask, (s08_t*)"LIGHT", E_RTOSAL_PRIO_29,
+                              demoTaskPerfLightTask, (u32_t)NULL, D_DEMO_TASK_STACK_SIZE,
+                              uiLightTaskStackBuffer, 0, D_RTOSAL_AUTO_START, 0);
+  M_DEMO_VERIFY(D_RTOSAL_SUCCESS == uiResult);
+
+  uiResult = rtosalTaskCreate(&stBusyTask, (s08_t*)"BUSY", E_RTOSAL_PRIO_30,
+                              demoTaskPerfBusyTask, (u32_t)NULL, D_DEMO_TASK_STACK_SIZE,
+                              uiBusyTaskStackBuffer, 0, D_RTOSAL_AUTO_START, 0);
+  M_DEMO_VERIFY(D_RTOSAL_SUCCESS == uiResult);
+
+  /* Tick period */
+  rtosalTimerSetPeriod(D_CLOCK_RATE * D_TICK_TIME_MS / D_PSP_MSEC);
+
+  udDemoStartCycles = pspMachinePerfCounterGet(D_PSP_CYCLE_COUNTER);
+}
+
+/**
+ * demoTaskPerfWork - work with branches and multiplications
+ *
+ */
+static void demoTaskPerfWork(u32_t uiSeed)
+{
+  u32_t uiIndex;
+
+  for (uiIndex = 0; uiIndex < D_DEMO_WORK_SIZE; uiIndex++)
+  {
+    if (0 != (uiIndex & uiSeed & 0x1))
+    {
+      uiDemoWork[uiIndex] += uiIndex * uiSeed;
+    }
+    else
+    {
+      uiDemoWork[uiIndex] ^= uiSeed;
+    }
+  }
+}
+
+/**
+ * demoTaskPerfBusyTask - runs whenever the other tasks do not
+ *
+ */
+static void demoTaskPerfBusyTask(void *pParameters)
+{
+  u32_t uiSeed = 0;
+
+  for (;;)
+  {
+    demoTaskPerfWork(uiSeed++);
+  }
+}
+
+/**
+ * demoTaskPerfLightTask - runs a single work item on every tick
+ *
+ */
+static void demoTaskPerfLightTask(void *pParameters)
+{
+  u32_t uiSeed = 0;
+
+  for (;;)
+  {
+    demoTaskPerfWork(uiSeed++);
+    rtosalTaskSleep(1);
+  }
+}
+
+/**
+ * demoTaskPerfPrint - print the counters of a task
+ *
+ */
+static void demoTaskPerfPrint(const char* pTaskName, rtosalTaskPerfCounters_t* pCounters)
+{
+  demoOutputMsg("%s: cycles %d, instret %d, branches %d, mispredicted %d, muls %d, i-cache misses %d\n", pTaskName,
+                (u32_t)pCounters->udCounter[D_RTOSAL_TASK_PERF_CYCLES], (u32_t)pCounters->udCounter[D_RTOSAL_TASK_PERF_INSTRET],
+                (u32_t)pCounters->udCounter[D_RTOSAL_TASK_PERF_EVENT0], (u32_t)pCounters->udCounter[D_RTOSAL_TASK_PERF_EVENT1],
+                (u32_t)pCounters->udCounter[D_RTOSAL_TASK_PERF_EVENT2], (u32_t)pCounters->udCounter[D_RTOSAL_TASK_PERF_EVENT3]);
+}
+
+/**
+ * demoTaskPerfMonitorTask - verify and print the counters of the tasks periodically
+ *
+ */
+static void demoTaskPerfMonitorTask(void *pParameters)
+{
+  rtosalTaskPerfCounters_t stBusy, stLight, stMonitor, stKernel;
+  u64_t udTotalCycles, udRunCycles;
+  u32_t uiPeriod;
+
+  for (uiPeriod = 0; uiPeriod < D_DEMO_NUM_OF_PERIODS; uiPeriod++)
+  {
+    rtosalTaskSleep(D_DEMO_MONITOR_PERIOD_TICKS);
+
+    M_DEMO_VERIFY(D_RTOSAL_SUCCESS == rtosalTaskGetPerfCounters(&stBusyTask, &stBusy));
+    M_DEMO_VERIFY(D_RTOSAL_SUCCESS == rtosalTaskGetPerfCounters(&stLightTask, &stLight));
+    M_DEMO_VERIFY(D_RTOSAL_SUCCESS == rtosalTaskGetPerfCounters(NULL, &stKernel));
+    M_DEMO_VERIFY(D_RTOSAL_SUCCESS == rtosalTaskGetPerfCounters(&stMonitorTask, &stMonitor));
+    udRunCycles = pspMachinePerfCounterGet(D_PSP_CYCLE_COUNTER) - udDemoStartCycles;
+
+    /* The busy task runs whenever the light task sleeps */
+    M_DEMO_VERIFY(stBusy.udCounter[D_RTOSAL_TASK_PERF_CYCLES] > stLight.udCounter[D_RTOSAL_TASK_PERF_CYCLES]);
+    M_DEMO_VERIFY(stBusy.udCounter[D_RTOSAL_TASK_PERF_INSTRET] > stLight.udCounter[D_RTOSAL_TASK_PERF_INSTRET]);
+    M_DEMO_VERIFY(0 != stLight.udCounter[D_RTOSAL_TASK_PERF_EVENT0]);
+
+    /* The tasks share the run */
+    udTotalCycles = stBusy.udCounter[D_RTOSAL_TASK_PERF_CYCLES] + stLight.udCounter[D_RTOSAL_TASK_PERF_CYCLES] +
+                    stMonitor.udCounter[D_RTOSAL_TASK_PERF_CYCLES] + stKernel.udCounter[D_RTOSAL_TASK_PERF_CYCLES];
+    M_DEMO_VERIFY(udTotalCycles <= udRunCycles);
+
+    demoOutputMsg("period %d, run cycles %d\n", uiPeriod, (u32_t)udRunCycles);
+    demoTaskPerfPrint("busy", &stBusy);
+    demoTaskPerfPrint("light", &stLight);
+    demoTaskPerfPrint("monitor", &stMonitor);
+    demoTaskPerfPrint("kernel", &stKernel);
+  }
+
+  M_DEMO_END_PRINT();
+}
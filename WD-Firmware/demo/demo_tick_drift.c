@@ -0,0 +1,174 @@
+/*
+* SPDX-License-Identifier: Apache-2.0
+* Copyright 2026 Western Digital Corporation or its affiliates.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http:*www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/**
+* @file   demo_tick_drift.c
+* @author Western Digital
+* @date   16.10.2026
+* @brief  Demo application for the drift-free RTOSAL tick.
+*         A task keeps the interrupts disabled for a few tick periods at a time, so ticks
+*         are missed. The demo verifies that the missed ticks were taken, so the kernel
+*         time follows the machine timer, and that rtosalGetTimeNs follows it too
+*/
+
+/**
+* include files
+*/
+#include "common_types.h"
+#include "rtosal_task_api.h"
+#include "rtosal_time_api.h"
+#include "psp_api.h"
+#include "demo_platform_al.h"
+#include "demo_utils.h"
+
+/**
+* definitions
+*/
+#define D_DEMO_TASK_STACK_SIZE        450
+#define D_DEMO_NUM_OF_ROUNDS          20
+#define D_DEMO_TICK_PERIOD            (D_CLOCK_RATE * D_TICK_TIME_MS / D_PSP_MSEC)
+/* Interrupts are disabled for 3.5 tick periods in each round */
+#define D_DEMO_NO_INT_CYCLES          (D_DEMO_TICK_PERIOD * 7 / 2)
+#define D_DEMO_NSEC_IN_SEC            1000000000ULL
+
+/**
+* macros
+*/
+#define M_DEMO_VERIFY(bCondition)   if (!(bCondition)) \
+                                    { \
+                                      M_DEMO_ERR_PRINT(); \
+                                      M_PSP_EBREAK(); \
+                                    }
+
+/**
+* types
+*/
+
+/**
+* local prototypes
+*/
+static void demoTickDriftCreateTasks(void *pParameters);
+static void demoTickDriftTask(void *pParameters);
+static void demoTickDriftTickHandler(void);
+
+/**
+* external prototypes
+*/
+
+/**
+* global variables
+*/
+static rtosalTask_t stTickDriftTask;
+static rtosalStackType_t uiTickDriftTaskStackBuffer[D_DEMO_TASK_STACK_SIZE];
+static volatile u32_t uiDemoNumOfTicks;
+
+/**
+* functions
+*/
+
+/**
+ * demoStart - startup point of the demo application. called from main function.
+ *
+ */
+void demoStart(void)
+{
+  M_DEMO_START_PRINT();
+
+  rtosalStart(demoTickDriftCreateTasks);
+}
+
+/**
+ * demoTickDriftCreateTasks - create the task. Called from RTOS abstraction layer before
+ *                            the scheduler is kicked on
+ *
+ */
+static void demoTickDriftCreateTasks(void *pParameters)
+{
+  u32_t uiResult;
+
+  /* Disable the timer interrupts until setup is done. */
+  pspMachineInterruptsDisableIntNumber(D_PSP_INTERRUPTS_MACHINE_TIMER);
+
+  uiResult = rtosalTaskCreate(&stTickDriftTask, (s08_t*)"DRIFT", E_RTOSAL_PRIO_29,
+                              demoTickDriftTask, (u32_t)NULL, D_DEMO_TASK_STACK_SIZE,
+                              uiTickDriftTaskStackBuffer, 0, D_RTOSAL_AUTO_START, 0);
+  M_DEMO_VERIFY(D_RTOSAL_SUCCESS == uiResult);
+
+  rtosalRegisterTimerTickHandler(demoTickDriftTickHandler);
+
+  /* Tick period */
+  rtosalTimerSetPeriod(D_DEMO_TICK_PERIOD);
+}
+
+/**
+ * demoTickDriftTickHandler - count the ticks the kernel took
+ *
+ */
+static void demoTickDriftTickHandler(void)
+{
+  uiDemoNumOfTicks++;
+}
+
+/**
+ * demoTickDriftTask - miss ticks, then verify the ticks and the time against the machine timer
+ *
+ */
+static void demoTickDriftTask(void *pParameters)
+{
+  u64_t udStartTime, udStartNs, udTimerCycles, udTimerNs, udNs, udPrevNs = 0;
+  u32_t uiRound, uiStartTicks, uiNumOfTicks, uiInterruptsState;
+
+  /* Start on a tick */
+  rtosalTaskSleep(1);
+
+  uiStartTicks = uiDemoNumOfTicks;
+  udStartTime = pspMachineTimerCounterGet();
+  udStartNs = rtosalGetTimeNs();
+
+  for (uiRound = 0; uiRound < D_DEMO_NUM_OF_ROUNDS; uiRound++)
+  {
+    /* Miss a few ticks */
+    pspMachineInterruptsDisable(&uiInterruptsState);
+    udTimerCycles = pspMachineTimerCounterGet();
+    while ((pspMachineTimerCounterGet() - udTimerCycles) < D_DEMO_NO_INT_CYCLES);
+    udNs = rtosalGetTimeNs();
+    pspMachineInterruptsRestore(uiInterruptsState);
+
+    /* The time goes on while the tick interrupts are pending */
+    M_DEMO_VERIFY(udNs > udPrevNs);
+    udPrevNs = udNs;
+
+    rtosalTaskSleep(1);
+  }
+
+  udNs = rtosalGetTimeNs() - udStartNs;
+  udTimerCycles = pspMachineTimerCounterGet() - udStartTime;
+  uiNumOfTicks = uiDemoNumOfTicks - uiStartTicks;
+  udTimerNs = (udTimerCycles / D_CLOCK_RATE) * D_DEMO_NSEC_IN_SEC + ((udTimerCycles % D_CLOCK_RATE) * D_DEMO_NSEC_IN_SEC) / D_CLOCK_RATE;
+
+  /* A tick was taken for every period - the missed ones too */
+  M_DEMO_VERIFY(uiNumOfTicks + 1 >= udTimerCycles / D_DEMO_TICK_PERIOD);
+  M_DEMO_VERIFY(uiNumOfTicks <= udTimerCycles / D_DEMO_TICK_PERIOD + 1);
+
+  /* The time follows the machine timer, up to the cycles between the reads */
+  M_DEMO_VERIFY(udNs <= udTimerNs + D_DEMO_NSEC_IN_SEC / D_PSP_MSEC);
+  M_DEMO_VERIFY(udTimerNs <= udNs + D_DEMO_NSEC_IN_SEC / D_PSP_MSEC);
+
+  demoOutputMsg("%d ticks in %d timer cycles, %d us\n", uiNumOfTicks, (u32_t)udTimerCycles, (u32_t)(udNs / D_PSP_MSEC));
+
+  M_DEMO_END_PRINT();
+}
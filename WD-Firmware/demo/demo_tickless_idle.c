@@ -0,0 +1,157 @@
+/*
+* SPDX-License-Identifier: Apache-2.0
+* Copyright 2026 Western Digital Corporation or its affiliates.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http:*www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/**
+* @file   demo_tickless_idle.c
+* @author Western Digital
+* @date   16.10.2026
+* @brief  Demo application for the RTOSAL tickless idle.
+*         A task sleeps for a number of ticks at a time, so the core is idle. The demo
+*         verifies that the sleeps took the right time, measured on the machine timer, and
+*         that the tick interrupts were suppressed while the core was halted
+*/
+
+/**
+* include files
+*/
+#include "common_types.h"
+#include "rtosal_task_api.h"
+#include "rtosal_time_api.h"
+#include "psp_api.h"
+#include "demo_platform_al.h"
+#include "demo_utils.h"
+
+/**
+* definitions
+*/
+#define D_DEMO_TASK_STACK_SIZE        450
+#define D_DEMO_SLEEP_TICKS            (200/D_TICK_TIME_MS)
+#define D_DEMO_NUM_OF_SLEEPS          5
+#define D_DEMO_TICK_PERIOD            (D_CLOCK_RATE * D_TICK_TIME_MS / D_PSP_MSEC)
+/* Ticks taken during a sleep - the tick that ends it, and one the sleep may have started just before */
+#define D_DEMO_MAX_TICKS_PER_SLEEP    2
+
+/**
+* macros
+*/
+#define M_DEMO_VERIFY(bCondition)   if (!(bCondition)) \
+                                    { \
+                                      M_DEMO_ERR_PRINT(); \
+                                      M_PSP_EBREAK(); \
+                                    }
+
+/**
+* types
+*/
+
+/**
+* local prototypes
+*/
+static void demoTicklessCreateTasks(void *pParameters);
+static void demoTicklessTask(void *pParameters);
+static void demoTicklessTickHandler(void);
+
+/**
+* external prototypes
+*/
+
+/**
+* global variables
+*/
+static rtosalTask_t stTicklessTask;
+static rtosalStackType_t uiTicklessTaskStackBuffer[D_DEMO_TASK_STACK_SIZE];
+static volatile u32_t uiDemoNumOfTicks;
+
+/**
+* functions
+*/
+
+/**
+ * demoStart - startup point of the demo application. called from main function.
+ *
+ */
+void demoStart(void)
+{
+  M_DEMO_START_PRINT();
+
+  rtosalStart(demoTicklessCreateTasks);
+}
+
+/**
+ * demoTicklessCreateTasks - create the task. Called from RTOS abstraction layer before
+ *                           the scheduler is kicked on
+ *
+ */
+static void demoTicklessCreateTasks(void *pParameters)
+{
+  u32_t uiResult;
+
+  /* Disable the timer interrupts until setup is done. */
+  pspMachineInterruptsDisableIntNumber(D_PSP_INTERRUPTS_MACHINE_TIMER);
+
+  uiResult = rtosalTaskCreate(&stTicklessTask, (s08_t*)"TICKLESS", E_RTOSAL_PRIO_29,
+                              demoTicklessTask, (u32_t)NULL, D_DEMO_TASK_STACK_SIZE,
+                              uiTicklessTaskStackBuffer, 0, D_RTOSAL_AUTO_START, 0);
+  M_DEMO_VERIFY(D_RTOSAL_SUCCESS == uiResult);
+
+  rtosalRegisterTimerTickHandler(demoTicklessTickHandler);
+
+  /* Tick period */
+  rtosalTimerSetPeriod(D_DEMO_TICK_PERIOD);
+}
+
+/**
+ * demoTicklessTickHandler - count the ticks the kernel took
+ *
+ */
+static void demoTicklessTickHandler(void)
+{
+  uiDemoNumOfTicks++;
+}
+
+/**
+ * demoTicklessTask - sleep and verify the time and the ticks of each sleep
+ *
+ */
+static void demoTicklessTask(void *pParameters)
+{
+  u64_t udSleepStart, udSleepTime;
+  u32_t uiSleep, uiNumOfTicks;
+
+  for (uiSleep = 0; uiSleep < D_DEMO_NUM_OF_SLEEPS; uiSleep++)
+  {
+    uiNumOfTicks = uiDemoNumOfTicks;
+    udSleepStart = pspMachineTimerCounterGet();
+
+    rtosalTaskSleep(D_DEMO_SLEEP_TICKS);
+
+    udSleepTime = pspMachineTimerCounterGet() - udSleepStart;
+    uiNumOfTicks = uiDemoNumOfTicks - uiNumOfTicks;
+
+    /* The tick count was stepped by the time the core was halted */
+    M_DEMO_VERIFY(udSleepTime >= (u64_t)(D_DEMO_SLEEP_TICKS - 1) * D_DEMO_TICK_PERIOD);
+    M_DEMO_VERIFY(udSleepTime <= (u64_t)(D_DEMO_SLEEP_TICKS + 1) * D_DEMO_TICK_PERIOD);
+
+    /* The ticks in between were suppressed */
+    M_DEMO_VERIFY(uiNumOfTicks <= D_DEMO_MAX_TICKS_PER_SLEEP);
+
+    demoOutputMsg("sleep %d: %d ticks, %d timer cycles, %d tick interrupts\n", uiSleep, D_DEMO_SLEEP_TICKS,
+                  (u32_t)udSleepTime, uiNumOfTicks);
+  }
+
+  M_DEMO_END_PRINT();
+}
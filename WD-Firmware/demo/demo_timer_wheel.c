@@ -0,0 +1,183 @@
+/*
+* SPDX-License-Identifier: Apache-2.0
+* Copyright 2026 Western Digital Corporation or its affiliates.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http:*www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/**
+* @file   demo_timer_wheel.c
+* @author Western Digital
+* @date   16.10.2026
+* @brief  Demo application for the high-resolution timer service.
+*         One-shot timers of different timeouts, a periodic timer and a timer that is
+*         stopped before it expires run on internal timer1 together. The demo verifies
+*         that each timer expired when it should - never early - and prints the worst
+*         expiration latency in cycles
+*/
+
+/**
+* include files
+*/
+#include "psp_api.h"
+#include "demo_platform_al.h"
+#include "demo_utils.h"
+
+/**
+* definitions
+*/
+#define D_DEMO_NUM_OF_ONE_SHOTS     16
+#define D_DEMO_ONE_SHOT_STEP        1500    /* Cycles between the timeouts of the one-shot timers */
+#define D_DEMO_PERIOD               2000    /* Cycles */
+#define D_DEMO_NUM_OF_PERIODS       50
+#define D_DEMO_STOPPED_TIMEOUT      10000   /* Cycles */
+/* Cycles from the expiration to the callback - the interrupt latency and the wheel resolution */
+#define D_DEMO_MAX_LATENCY          1000
+#define D_DEMO_PERIODIC_INDEX       D_DEMO_NUM_OF_ONE_SHOTS
+#define D_DEMO_STOPPED_INDEX        (D_DEMO_NUM_OF_ONE_SHOTS + 1)
+#define D_DEMO_NUM_OF_TIMERS        (D_DEMO_NUM_OF_ONE_SHOTS + 2)
+
+/**
+* macros
+*/
+#define M_DEMO_VERIFY(bCondition)   if (!(bCondition)) \
+                                    { \
+                                      M_DEMO_ERR_PRINT(); \
+                                      M_PSP_EBREAK(); \
+                                    }
+
+#define M_DEMO_CYCLES()             M_PSP_READ_CSR64(D_PSP_MCYCLE_NUM, D_PSP_MCYCLEH_NUM)
+
+/**
+* types
+*/
+
+/**
+* local prototypes
+*/
+
+/**
+* external prototypes
+*/
+
+/**
+* global variables
+*/
+pspTimerWheelTimer_t g_stDemoTimers[D_DEMO_NUM_OF_TIMERS];
+volatile u32_t g_uiDemoExpirations[D_DEMO_NUM_OF_TIMERS];
+volatile u32_t g_uiDemoMaxLatency;
+volatile u32_t g_uiDemoEarly;
+
+/**
+* APIs
+*/
+
+/**
+ * @brief - Timer callback - count the expiration and check its latency
+ *
+ * @parameter - pArg - the timer
+ */
+void demoTimerWheelCallback(void* pArg)
+{
+  pspTimerWheelTimer_t* pTimer = (pspTimerWheelTimer_t*)pArg;
+  u64_t udNow = M_DEMO_CYCLES();
+  u64_t udExpiry = pTimer->udExpiryCycles;
+  u32_t uiLatency;
+
+  /* A periodic timer is already set to its next expiration */
+  if (0 != pTimer->uiPeriodCycles)
+  {
+    udExpiry -= pTimer->uiPeriodCycles;
+  }
+
+  if (udNow < udExpiry)
+  {
+    g_uiDemoEarly++;
+  }
+  else
+  {
+    uiLatency = (u32_t)(udNow - udExpiry);
+    if (uiLatency > g_uiDemoMaxLatency)
+    {
+      g_uiDemoMaxLatency = uiLatency;
+    }
+  }
+
+  g_uiDemoExpirations[pTimer - g_stDemoTimers]++;
+
+  if ((&g_stDemoTimers[D_DEMO_PERIODIC_INDEX] == pTimer) &&
+      (D_DEMO_NUM_OF_PERIODS == g_uiDemoExpirations[D_DEMO_PERIODIC_INDEX]))
+  {
+    pspTimerWheelTimerStop(pTimer);
+  }
+}
+
+/**
+ * @brief - demoStart - startup point of the demo application. called from main function.
+ *
+ */
+void demoStart(void)
+{
+  u32_t uiTimer, uiInterruptsState;
+  u64_t udStart;
+
+  M_DEMO_START_PRINT();
+
+  /* Register interrupt vector */
+  pspMachineInterruptsSetVecTableAddress(&M_PSP_VECT_TABLE);
+
+  pspTimerWheelInit(D_PSP_INTERNAL_TIMER1);
+  pspMachineInterruptsEnable();
+
+  udStart = M_DEMO_CYCLES();
+
+  /* One-shot timers, started in reverse order of their timeouts */
+  for (uiTimer = 0; uiTimer < D_DEMO_NUM_OF_ONE_SHOTS; uiTimer++)
+  {
+    pspTimerWheelTimerStart(&g_stDemoTimers[uiTimer], (D_DEMO_NUM_OF_ONE_SHOTS - uiTimer) * D_DEMO_ONE_SHOT_STEP, 0,
+                            demoTimerWheelCallback, &g_stDemoTimers[uiTimer]);
+  }
+  pspTimerWheelTimerStart(&g_stDemoTimers[D_DEMO_PERIODIC_INDEX], D_DEMO_PERIOD, D_DEMO_PERIOD,
+                          demoTimerWheelCallback, &g_stDemoTimers[D_DEMO_PERIODIC_INDEX]);
+  pspTimerWheelTimerStart(&g_stDemoTimers[D_DEMO_STOPPED_INDEX], D_DEMO_STOPPED_TIMEOUT, 0,
+                          demoTimerWheelCallback, &g_stDemoTimers[D_DEMO_STOPPED_INDEX]);
+
+  M_DEMO_VERIFY(D_PSP_TRUE == pspTimerWheelTimerIsActive(&g_stDemoTimers[D_DEMO_STOPPED_INDEX]));
+  pspTimerWheelTimerStop(&g_stDemoTimers[D_DEMO_STOPPED_INDEX]);
+  M_DEMO_VERIFY(D_PSP_FALSE == pspTimerWheelTimerIsActive(&g_stDemoTimers[D_DEMO_STOPPED_INDEX]));
+
+  while (pspTimerWheelTimerIsActive(&g_stDemoTimers[D_DEMO_PERIODIC_INDEX]))
+  {
+    /* wait for the periodic timer, which runs the longest */
+  }
+
+  pspMachineInterruptsDisable(&uiInterruptsState);
+
+  /* Each one-shot timer expired once, the periodic one on each period, the stopped one never */
+  for (uiTimer = 0; uiTimer < D_DEMO_NUM_OF_ONE_SHOTS; uiTimer++)
+  {
+    M_DEMO_VERIFY(1 == g_uiDemoExpirations[uiTimer]);
+    M_DEMO_VERIFY(D_PSP_FALSE == pspTimerWheelTimerIsActive(&g_stDemoTimers[uiTimer]));
+  }
+  M_DEMO_VERIFY(D_DEMO_NUM_OF_PERIODS == g_uiDemoExpirations[D_DEMO_PERIODIC_INDEX]);
+  M_DEMO_VERIFY(0 == g_uiDemoExpirations[D_DEMO_STOPPED_INDEX]);
+
+  /* No timer expired early, nor late by more than the latency */
+  M_DEMO_VERIFY(0 == g_uiDemoEarly);
+  M_DEMO_VERIFY(g_uiDemoMaxLatency <= D_DEMO_MAX_LATENCY);
+
+  demoOutputMsg("%d timers in %d cycles, max latency %d cycles\n", D_DEMO_NUM_OF_TIMERS,
+                (u32_t)(M_DEMO_CYCLES() - udStart), g_uiDemoMaxLatency);
+
+  M_DEMO_END_PRINT();
+}
@@ -34,11 +34,14 @@
 #include "psp_macros.h"
 #include "psp_pragmas.h"
 #include "psp_attributes.h"
+#include "psp_bitmanip.h"
 #include "psp_memory_utils.h"
+#include "psp_crc.h"
 #include "psp_int_vect.h"
 #include "psp_version.h"
 #include "psp_timers.h"
 #include "psp_interrupts.h"
+#include "psp_trace.h"
 #ifdef D_SWERV_EH1
   #include "psp_csrs_eh1.h"
   #include "psp_timers_eh1.h"
@@ -46,6 +49,10 @@
   #include "psp_ext_interrupts_eh1.h"
   #include "psp_pmc_eh1.h"
   #include "psp_performance_monitor_eh1.h"
+  #include "psp_profile_eh1.h"
+  #include "psp_pmu_mux_eh1.h"
+  #include "psp_pc_sample_eh1.h"
+  #include "psp_timer_wheel_eh1.h"
   #include "psp_nmi_eh1.h"
   #include "psp_cache_control_eh1.h"
   #include "psp_corr_err_cnt_eh1.h"
@@ -63,6 +70,10 @@
   #include "psp_nmi_eh2.h"
   #include "psp_mutex_eh2.h"
   #include "psp_atomics_eh2.h"
+  #include "psp_atomics_inline_eh2.h"
+  #include "psp_ring_eh2.h"
+  #include "psp_ipi_eh2.h"
+  #include "psp_barrier_eh2.h"
   #include "psp_intrinsics_eh2.h"
   #include "psp_int_vect_eh2.h"
 #endif
@@ -33,6 +33,22 @@
 /**
 * definitions
 */
+/* Bounded exponential backoff of the spin locks, in spin-loop iterations */
+#ifndef D_PSP_ATOMICS_BACKOFF_MIN
+  #define D_PSP_ATOMICS_BACKOFF_MIN        4
+#endif
+#ifndef D_PSP_ATOMICS_BACKOFF_MAX
+  #define D_PSP_ATOMICS_BACKOFF_MAX        256
+#endif
+/* Ticket lock backoff per waiter that is ahead in the queue, in spin-loop iterations */
+#ifndef D_PSP_ATOMICS_TICKET_BACKOFF
+  #define D_PSP_ATOMICS_TICKET_BACKOFF     16
+#endif
+
+/* Ticket lock word: 'now serving' in bits 0..15 and 'next ticket' in bits 16..31 */
+#define D_PSP_ATOMICS_TICKET_SERVING_MASK  0x0000FFFF
+#define D_PSP_ATOMICS_TICKET_NEXT_SHIFT    16
+#define D_PSP_ATOMICS_TICKET_NEXT_INC      (1 << D_PSP_ATOMICS_TICKET_NEXT_SHIFT)
 
 /**
 * types
@@ -49,19 +65,21 @@
 /**
 * macros
 */
-/* Atomic operations macros */
-#define M_PSP_ATOMIC_COMPARE_AND_SET(pAddress, uiExpectedValue, uiDesiredValue)   pspAtomicsCompareAndSet(pAddress, uiExpectedValue, uiDesiredValue);
+/* Atomic operations macros. The compare-and-set and AMO macros are inline (psp_atomics_inline_eh2.h) */
+#define M_PSP_ATOMIC_COMPARE_AND_SET(pAddress, uiExpectedValue, uiDesiredValue)   pspAtomicsInlineCompareAndSet(pAddress, uiExpectedValue, uiDesiredValue);
 #define M_PSP_ATOMIC_ENTER_CRITICAL_SECTION(pAddress)                             pspAtomicsEnterCriticalSection(pAddress);
 #define M_PSP_ATOMIC_EXIT_CRITICAL_SECTION(pAddress)                              pspAtomicsExitCriticalSection(pAddress);
-#define M_PSP_ATOMIC_AMO_SWAP(pAddress, uiValueToSwap)                            pspAtomicsAmoSwap(pAddress, uiValueToSwap);
-#define M_PSP_ATOMIC_AMO_ADD(pAddress, uiValueToAdd)                              pspAtomicsAmoAdd(pAddress, uiValueToAdd);
-#define M_PSP_ATOMIC_AMO_AND(pAddress, uiValueToAndWith)                          pspAtomicsAmoAnd(pAddress, uiValueToAndWith);
-#define M_PSP_ATOMIC_AMO_OR(pAddress, uiValueToOrWith)                            pspAtomicsAmoOr(pAddress, uiValueToOrWith);
-#define M_PSP_ATOMIC_AMO_XOR(pAddress, uiValueToXorWith)                          pspAtomicsAmoXor(pAddress, uiValueToXorWith);
-#define M_PSP_ATOMIC_AMO_MIN(pAddress, uiValueToCompare)                          pspAtomicsAmoMin(pAddress, uiValueToCompare);
-#define M_PSP_ATOMIC_AMO_MAX(pAddress, uiValueToCompare)                          pspAtomicsAmoMax(pAddress, uiValueToCompare);
-#define M_PSP_ATOMIC_AMO_MIN_UNSIGINED(pAddress, uiValueToCompare)                pspAtomicsAmoMinUnsigned(pAddress, uiValueToCompare);
-#define M_PSP_ATOMIC_AMO_MAX_UNSIGNED(pAddress, uiValueToCompare)                 pspAtomicsAmoMaxUnsigned(pAddress, uiValueToCompare);
+#define M_PSP_ATOMIC_ENTER_CRITICAL_SECTION_TICKET(pAddress)                      pspAtomicsEnterCriticalSectionTicket(pAddress);
+#define M_PSP_ATOMIC_EXIT_CRITICAL_SECTION_TICKET(pAddress)                       pspAtomicsExitCriticalSectionTicket(pAddress);
+#define M_PSP_ATOMIC_AMO_SWAP(pAddress, uiValueToSwap)                            pspAtomicsInlineAmoSwap(pAddress, uiValueToSwap);
+#define M_PSP_ATOMIC_AMO_ADD(pAddress, uiValueToAdd)                              pspAtomicsInlineAmoAdd(pAddress, uiValueToAdd);
+#define M_PSP_ATOMIC_AMO_AND(pAddress, uiValueToAndWith)                          pspAtomicsInlineAmoAnd(pAddress, uiValueToAndWith);
+#define M_PSP_ATOMIC_AMO_OR(pAddress, uiValueToOrWith)                            pspAtomicsInlineAmoOr(pAddress, uiValueToOrWith);
+#define M_PSP_ATOMIC_AMO_XOR(pAddress, uiValueToXorWith)                          pspAtomicsInlineAmoXor(pAddress, uiValueToXorWith);
+#define M_PSP_ATOMIC_AMO_MIN(pAddress, uiValueToCompare)                          pspAtomicsInlineAmoMin(pAddress, uiValueToCompare);
+#define M_PSP_ATOMIC_AMO_MAX(pAddress, uiValueToCompare)                          pspAtomicsInlineAmoMax(pAddress, uiValueToCompare);
+#define M_PSP_ATOMIC_AMO_MIN_UNSIGINED(pAddress, uiValueToCompare)                pspAtomicsInlineAmoMinUnsigned(pAddress, uiValueToCompare);
+#define M_PSP_ATOMIC_AMO_MAX_UNSIGNED(pAddress, uiValueToCompare)                 pspAtomicsInlineAmoMaxUnsigned(pAddress, uiValueToCompare);
 
 /**
 * global variables
@@ -83,106 +101,149 @@
 D_PSP_NO_INLINE u32_t pspAtomicsCompareAndSet(u32_t* pAddress, u32_t uiExpectedValue, u32_t uiDesiredValue);
 
 /**
-* @brief - spin-lock on a parameter in a given memory address
+* @brief - spin-lock on a parameter in a given memory address.
+*          While the lock is taken, wait with bounded exponential backoff
 *
-* @parameter - (a0) address in the memory with the parameter to check
+* @parameter - address in the memory with the parameter to check
 */
 D_PSP_NO_INLINE void pspAtomicsEnterCriticalSection(u32_t* pAddress);
 
 /**
 * @brief - release the lock by parameter in a given memory address using atomic command
 *
-* @parameter - (a0) address in the memory with the parameter to set
+* @parameter - address in the memory with the parameter to set
 */
 D_PSP_NO_INLINE void pspAtomicsExitCriticalSection(u32_t* pAddress);
 
+/**
+* @brief - ticket spin-lock on a parameter in a given memory address. The lock is granted
+*          in FIFO order. While waiting, backoff in proportion to the number of waiters ahead
+*
+* @parameter - address in the memory of the ticket lock word (0 == unlocked)
+*/
+D_PSP_NO_INLINE void pspAtomicsEnterCriticalSectionTicket(u32_t* pAddress);
+
+/**
+* @brief - release a ticket lock - hand it over to the next ticket
+*
+* @parameter - address in the memory of the ticket lock word
+*/
+D_PSP_NO_INLINE void pspAtomicsExitCriticalSectionTicket(u32_t* pAddress);
+
+/**
+* @brief - queue (MCS-style) spin-lock. The harts wait in FIFO order, each hart spins on
+*          its own flag and the lock owner hands the lock over to its successor. The queue
+*          nodes are indexed by hart id, so a hart can wait only once on a given lock
+*
+* @parameter - address in the memory of the queue tail (hart id + 1 of the last hart in the queue, 0 == unlocked)
+* @parameter - the successor of each hart in the queue (hart id + 1, 0 == none) - array of D_PSP_NUM_OF_HARTS
+* @parameter - the wait flag of each hart in the queue - array of D_PSP_NUM_OF_HARTS
+*/
+D_PSP_NO_INLINE void pspAtomicsEnterCriticalSectionQueue(u32_t* pAddress, u32_t* pQueueNext, u32_t* pQueueWait);
+
+/**
+* @brief - release a queue (MCS-style) spin-lock - hand it over to the successor, if any
+*
+* @parameter - address in the memory of the queue tail
+* @parameter - the successor of each hart in the queue - array of D_PSP_NUM_OF_HARTS
+* @parameter - the wait flag of each hart in the queue - array of D_PSP_NUM_OF_HARTS
+*/
+D_PSP_NO_INLINE void pspAtomicsExitCriticalSectionQueue(u32_t* pAddress, u32_t* pQueueNext, u32_t* pQueueWait);
+
+/**
+* @brief - spin for a given number of iterations. Used as backoff by the spin-locks
+*
+* @parameter - number of spin-loop iterations
+*/
+void pspAtomicsBackoff(u32_t uiIterations);
+
 /**
 * @brief - AMO (Atomic Memory Operation) Swap command
 *
-* @parameter - (a0) address in the memory with the parameter to check and add
-* @parameter - (a1) value to load to that address
+* @parameter - address in the memory with the parameter to check and add
+* @parameter - value to load to that address
 *
-* @return    - (a0) previous value in the address
+* @return    - previous value in the address
 */
 u32_t pspAtomicsAmoSwap(u32_t* pAddress, u32_t uiValueToSwap);
 
 /**
 * @brief - AMO (Atomic Memory Operation) Add command
 *
-* @parameter - (a0) address in the memory with the parameter to check and add
-* @parameter - (a1) value to add
+* @parameter - address in the memory with the parameter to check and add
+* @parameter - value to add
 *
-* @return    - (a0) previous value in the address
+* @return    - previous value in the address
 */
 u32_t pspAtomicsAmoAdd(u32_t* pAddress, u32_t uiValueToAdd);
 
 /**
 * @brief - AMO (Atomic Memory Operation) bitwise AND command
 *
-* @parameter - (a0) address in the memory with the parameter to check and do bitwise-AND with
-* @parameter - (a1) value to do bitwise-AND with the content of the given memory
+* @parameter - address in the memory with the parameter to check and do bitwise-AND with
+* @parameter - value to do bitwise-AND with the content of the given memory
 *
-* @return    - (a0) previous value in the address
+* @return    - previous value in the address
 */
 u32_t pspAtomicsAmoAnd(u32_t* pAddress, u32_t uiValueToAndWith);
 
 /**
 * @brief - AMO (Atomic Memory Operation) bitwise OR command
 *
-* @parameter - (a0) address in the memory with the parameter to check and do bitwise-OR with
-* @parameter - (a1) value to do bitwise-OR with the content of the given memory
+* @parameter - address in the memory with the parameter to check and do bitwise-OR with
+* @parameter - value to do bitwise-OR with the content of the given memory
 *
-* @return    - (a0) previous value in the address
+* @return    - previous value in the address
 */
 u32_t pspAtomicsAmoOr(u32_t* pAddress, u32_t uiValueToOrWith);
 
 /**
 * @brief - AMO (Atomic Memory Operation) bitwise XOR command
 *
-* @parameter - (a0) address in the memory with the parameter to check and do bitwise-XOR with
-* @parameter - (a1) value to do bitwise-XOR with the content of the given memory
+* @parameter - address in the memory with the parameter to check and do bitwise-XOR with
+* @parameter - value to do bitwise-XOR with the content of the given memory
 *
-* @return    - (a0) previous value in the address
+* @return    - previous value in the address
 */
 u32_t pspAtomicsAmoXor(u32_t* pAddress, u32_t uiValueToXorWith);
 
 /**
 * @brief - AMO (Atomic Memory Operation) min command
 *
-* @parameter - (a0) address in the memory with the parameter to compare
-* @parameter - (a1) value to compare with the content of the given memory, to determine the minimum
+* @parameter - address in the memory with the parameter to compare
+* @parameter - value to compare with the content of the given memory, to determine the minimum
 *
-* @return    - (a0) previous value in the address
+* @return    - previous value in the address
 */
 u32_t pspAtomicsAmoMin(u32_t* pAddress, u32_t uiValueToCompare);
 
 /**
 * @brief - AMO (Atomic Memory Operation) max command
 *
-* @parameter - (a0) address in the memory with the parameter to compare
-* @parameter - (a1) value to compare with the content of the given memory, to determine the maximum
+* @parameter - address in the memory with the parameter to compare
+* @parameter - value to compare with the content of the given memory, to determine the maximum
 *
-* @return    - (a0) previous value in the address
+* @return    - previous value in the address
 */
 u32_t pspAtomicsAmoMax(u32_t* pAddress, u32_t uiValueToCompare);
 
 /**
 * @brief - AMO (Atomic Memory Operation) min command - unsigned
 *
-* @parameter - (a0) address in the memory with the parameter to compare (unsigned)
-* @parameter - (a1) unsigned value to compare with the content of the given memory, to determine the minimum
+* @parameter - address in the memory with the parameter to compare (unsigned)
+* @parameter - unsigned value to compare with the content of the given memory, to determine the minimum
 *
-* @return    - (a0) previous value in the address
+* @return    - previous value in the address
 */
 u32_t pspAtomicsAmoMinUnsigned(u32_t* pAddress, u32_t uiValueToCompare);
 
 /**
 * @brief - AMO (Atomic Memory Operation) max command - unsigned
 *
-* @parameter - (a0) address in the memory with the parameter to compare (unsigned)
-* @parameter - (a1) unsigned value to compare with the content of the given memory, to determine the maximum
+* @parameter - address in the memory with the parameter to compare (unsigned)
+* @parameter - unsigned value to compare with the content of the given memory, to determine the maximum
 *
-* @return    - (a0) previous value in the address
+* @return    - previous value in the address
 */
 u32_t pspAtomicsAmoMaxUnsigned(u32_t* pAddress, u32_t uiValueToCompare);
 
@@ -0,0 +1,331 @@
+/*
+* SPDX-License-Identifier: Apache-2.0
+* Copyright 2026 Western Digital Corporation or its affiliates.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http:*www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+/**
+* @file   psp_atomics_inline_eh2.h
+* @author Western Digital
+* @date   16.10.2026
+* @brief  The file contains inline atomic operations on SweRV EH2. The operands are passed
+*         to the asm statements through register constraints, so the compiler can inline
+*         the operations and allocate registers around them. Fetch-and-op variants that
+*         the AMO commands do not cover are implemented with lr/sc loops
+*/
+#ifndef  __PSP_ATOMICS_INLINE_EH2_H__
+#define  __PSP_ATOMICS_INLINE_EH2_H__
+
+/**
+* include files
+*/
+
+/**
+* definitions
+*/
+
+/**
+* types
+*/
+
+/**
+* local prototypes
+*/
+
+/**
+* external prototypes
+*/
+
+/**
+* macros
+*/
+/* AMO command on a word in the memory. uiPrevValue gets the previous value in the address */
+#define M_PSP_ATOMICS_INLINE_AMO(strAmoCommand, uiPrevValue, pAddress, uiValue) \
+  __asm__ volatile (strAmoCommand " %0, %2, %1" : "=r" (uiPrevValue), "+A" (*(pAddress)) : "r" (uiValue) : "memory")
+
+/* Acquire fence - memory accesses that follow are not done before the loads that precede it */
+#define M_PSP_ATOMICS_FENCE_ACQUIRE()   __asm__ volatile ("fence r, rw" : : : "memory")
+/* Release fence - memory accesses that precede it are done before the stores that follow */
+#define M_PSP_ATOMICS_FENCE_RELEASE()   __asm__ volatile ("fence rw, w" : : : "memory")
+
+/**
+* global variables
+*/
+
+/**
+* APIs
+*/
+
+/**
+* @brief - AMO (Atomic Memory Operation) Swap command
+*
+* @parameter - address in the memory
+* @parameter - value to load to that address
+*
+* @return    - previous value in the address
+*/
+D_PSP_ALWAYS_INLINE u32_t pspAtomicsInlineAmoSwap(u32_t* pAddress, u32_t uiValueToSwap)
+{
+  u32_t uiPrevValue;
+
+  M_PSP_ATOMICS_INLINE_AMO("amoswap.w", uiPrevValue, pAddress, uiValueToSwap);
+
+  return uiPrevValue;
+}
+
+/**
+* @brief - AMO (Atomic Memory Operation) Add command
+*
+* @parameter - address in the memory
+* @parameter - value to add
+*
+* @return    - previous value in the address
+*/
+D_PSP_ALWAYS_INLINE u32_t pspAtomicsInlineAmoAdd(u32_t* pAddress, u32_t uiValueToAdd)
+{
+  u32_t uiPrevValue;
+
+  M_PSP_ATOMICS_INLINE_AMO("amoadd.w", uiPrevValue, pAddress, uiValueToAdd);
+
+  return uiPrevValue;
+}
+
+/**
+* @brief - AMO (Atomic Memory Operation) bitwise AND command
+*
+* @parameter - address in the memory
+* @parameter - value to do bitwise-AND with the content of the given memory
+*
+* @return    - previous value in the address
+*/
+D_PSP_ALWAYS_INLINE u32_t pspAtomicsInlineAmoAnd(u32_t* pAddress, u32_t uiValueToAndWith)
+{
+  u32_t uiPrevValue;
+
+  M_PSP_ATOMICS_INLINE_AMO("amoand.w", uiPrevValue, pAddress, uiValueToAndWith);
+
+  return uiPrevValue;
+}
+
+/**
+* @brief - AMO (Atomic Memory Operation) bitwise OR command
+*
+* @parameter - address in the memory
+* @parameter - value to do bitwise-OR with the content of the given memory
+*
+* @return    - previous value in the address
+*/
+D_PSP_ALWAYS_INLINE u32_t pspAtomicsInlineAmoOr(u32_t* pAddress, u32_t uiValueToOrWith)
+{
+  u32_t uiPrevValue;
+
+  M_PSP_ATOMICS_INLINE_AMO("amoor.w", uiPrevValue, pAddress, uiValueToOrWith);
+
+  return uiPrevValue;
+}
+
+/**
+* @brief - AMO (Atomic Memory Operation) bitwise XOR command
+*
+* @parameter - address in the memory
+* @parameter - value to do bitwise-XOR with the content of the given memory
+*
+* @return    - previous value in the address
+*/
+D_PSP_ALWAYS_INLINE u32_t pspAtomicsInlineAmoXor(u32_t* pAddress, u32_t uiValueToXorWith)
+{
+  u32_t uiPrevValue;
+
+  M_PSP_ATOMICS_INLINE_AMO("amoxor.w", uiPrevValue, pAddress, uiValueToXorWith);
+
+  return uiPrevValue;
+}
+
+/**
+* @brief - AMO (Atomic Memory Operation) min command
+*
+* @parameter - address in the memory
+* @parameter - value to compare with the content of the given memory, to determine the minimum
+*
+* @return    - previous value in the address
+*/
+D_PSP_ALWAYS_INLINE u32_t pspAtomicsInlineAmoMin(u32_t* pAddress, u32_t uiValueToCompare)
+{
+  u32_t uiPrevValue;
+
+  M_PSP_ATOMICS_INLINE_AMO("amomin.w", uiPrevValue, pAddress, uiValueToCompare);
+
+  return uiPrevValue;
+}
+
+/**
+* @brief - AMO (Atomic Memory Operation) max command
+*
+* @parameter - address in the memory
+* @parameter - value to compare with the content of the given memory, to determine the maximum
+*
+* @return    - previous value in the address
+*/
+D_PSP_ALWAYS_INLINE u32_t pspAtomicsInlineAmoMax(u32_t* pAddress, u32_t uiValueToCompare)
+{
+  u32_t uiPrevValue;
+
+  M_PSP_ATOMICS_INLINE_AMO("amomax.w", uiPrevValue, pAddress, uiValueToCompare);
+
+  return uiPrevValue;
+}
+
+/**
+* @brief - AMO (Atomic Memory Operation) min command - unsigned
+*
+* @parameter - address in the memory
+* @parameter - unsigned value to compare with the content of the given memory, to determine the minimum
+*
+* @return    - previous value in the address
+*/
+D_PSP_ALWAYS_INLINE u32_t pspAtomicsInlineAmoMinUnsigned(u32_t* pAddress, u32_t uiValueToCompare)
+{
+  u32_t uiPrevValue;
+
+  M_PSP_ATOMICS_INLINE_AMO("amominu.w", uiPrevValue, pAddress, uiValueToCompare);
+
+  return uiPrevValue;
+}
+
+/**
+* @brief - AMO (Atomic Memory Operation) max command - unsigned
+*
+* @parameter - address in the memory
+* @parameter - unsigned value to compare with the content of the given memory, to determine the maximum
+*
+* @return    - previous value in the address
+*/
+D_PSP_ALWAYS_INLINE u32_t pspAtomicsInlineAmoMaxUnsigned(u32_t* pAddress, u32_t uiValueToCompare)
+{
+  u32_t uiPrevValue;
+
+  M_PSP_ATOMICS_INLINE_AMO("amomaxu.w", uiPrevValue, pAddress, uiValueToCompare);
+
+  return uiPrevValue;
+}
+
+/**
+* @brief - compare and swap a value in the memory using lr/sc commands. A failed
+*          store-conditional is retried, so the swap fails only on a value mismatch
+*
+* @parameter - address in the memory to compare and set the value there
+* @parameter - expected value in the memory address
+* @parameter - new value to set at that memory address
+*
+* @return    - previous value in the address. Equals the expected value on success
+*/
+D_PSP_ALWAYS_INLINE u32_t pspAtomicsInlineCompareAndSwap(u32_t* pAddress, u32_t uiExpectedValue, u32_t uiDesiredValue)
+{
+  u32_t uiPrevValue, uiScFail;
+
+  __asm__ volatile ("1: lr.w.aqrl %0, %2\n"
+                    "   bne       %0, %3, 2f\n"
+                    "   sc.w.rl   %1, %4, %2\n"
+                    "   bnez      %1, 1b\n"
+                    "2:"
+                    : "=&r" (uiPrevValue), "=&r" (uiScFail), "+A" (*pAddress)
+                    : "r" (uiExpectedValue), "r" (uiDesiredValue) : "memory");
+
+  return uiPrevValue;
+}
+
+/**
+* @brief - compare and set a value in the memory using lr/sc commands
+*
+* @parameter - address in the memory to compare and set the value there
+* @parameter - expected value in the memory address
+* @parameter - new value to set at that memory address
+*
+* @return    - 0 - success. Otherwise - failure
+*/
+D_PSP_ALWAYS_INLINE u32_t pspAtomicsInlineCompareAndSet(u32_t* pAddress, u32_t uiExpectedValue, u32_t uiDesiredValue)
+{
+  return (uiExpectedValue != pspAtomicsInlineCompareAndSwap(pAddress, uiExpectedValue, uiDesiredValue));
+}
+
+/**
+* @brief - fetch-and-NAND using lr/sc commands. No AMO command does bitwise-NAND
+*
+* @parameter - address in the memory
+* @parameter - value to do bitwise-NAND with the content of the given memory
+*
+* @return    - previous value in the address
+*/
+D_PSP_ALWAYS_INLINE u32_t pspAtomicsInlineFetchAndNand(u32_t* pAddress, u32_t uiValueToNandWith)
+{
+  u32_t uiPrevValue, uiNewValue, uiScFail;
+
+  __asm__ volatile ("1: lr.w.aqrl %0, %3\n"
+                    "   and       %1, %0, %4\n"
+                    "   not       %1, %1\n"
+                    "   sc.w.rl   %2, %1, %3\n"
+                    "   bnez      %2, 1b"
+                    : "=&r" (uiPrevValue), "=&r" (uiNewValue), "=&r" (uiScFail), "+A" (*pAddress)
+                    : "r" (uiValueToNandWith) : "memory");
+
+  return uiPrevValue;
+}
+
+/**
+* @brief - increment a counter in the memory, unless it already reached a limit, using lr/sc commands
+*
+* @parameter - address in the memory of the counter
+* @parameter - limit of the counter (unsigned)
+*
+* @return    - previous value in the address. Equals or above the limit when the counter is not incremented
+*/
+D_PSP_ALWAYS_INLINE u32_t pspAtomicsInlineFetchAndIncrementBounded(u32_t* pAddress, u32_t uiLimit)
+{
+  u32_t uiPrevValue, uiNewValue, uiScFail;
+
+  __asm__ volatile ("1: lr.w.aqrl %0, %3\n"
+                    "   bgeu      %0, %4, 2f\n"
+                    "   addi      %1, %0, 1\n"
+                    "   sc.w.rl   %2, %1, %3\n"
+                    "   bnez      %2, 1b\n"
+                    "2:"
+                    : "=&r" (uiPrevValue), "=&r" (uiNewValue), "=&r" (uiScFail), "+A" (*pAddress)
+                    : "r" (uiLimit) : "memory");
+
+  return uiPrevValue;
+}
+
+/**
+* @brief - decrement a counter in the memory, unless it is already 0, using lr/sc commands
+*
+* @parameter - address in the memory of the counter
+*
+* @return    - previous value in the address. 0 when the counter is not decremented
+*/
+D_PSP_ALWAYS_INLINE u32_t pspAtomicsInlineFetchAndDecrementIfNotZero(u32_t* pAddress)
+{
+  u32_t uiPrevValue, uiNewValue, uiScFail;
+
+  __asm__ volatile ("1: lr.w.aqrl %0, %3\n"
+                    "   beqz      %0, 2f\n"
+                    "   addi      %1, %0, -1\n"
+                    "   sc.w.rl   %2, %1, %3\n"
+                    "   bnez      %2, 1b\n"
+                    "2:"
+                    : "=&r" (uiPrevValue), "=&r" (uiNewValue), "=&r" (uiScFail), "+A" (*pAddress)
+                    : : "memory");
+
+  return uiPrevValue;
+}
+
+#endif /* __PSP_ATOMICS_INLINE_EH2_H__ */
@@ -40,6 +40,7 @@
 #define D_PSP_WEAK             __attribute__(( weak ))
 #define D_PSP_TEXT_SECTION     __attribute__((section(".psp_code_section")))
 #define D_PSP_DATA_SECTION     __attribute__((section(".psp_data_section")))
+#define D_PSP_DCCM_DATA_SECTION __attribute__((section(".bss.psp_dccm_data_section")))
 #define D_PSP_NO_RETURN        __attribute__((noreturn))
 #define D_PSP_USED             __attribute__((used))
 
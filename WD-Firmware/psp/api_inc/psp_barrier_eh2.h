@@ -0,0 +1,107 @@
+/*
+* SPDX-License-Identifier: Apache-2.0
+* Copyright 2026 Western Digital Corporation or its affiliates.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http:*www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+/**
+* @file   psp_barrier_eh2.h
+* @author Western Digital
+* @date   16.10.2026
+* @brief  The file defines a reusable barrier for the harts of SweRV EH2 and a
+*         parallel-for that splits an index range across all the harts of the core.
+*         The barrier is sense-reversing: the last hart to arrive flips the sense,
+*         so the same barrier can be waited on again right away
+*/
+#ifndef  __PSP_BARRIER_EH2_H__
+#define  __PSP_BARRIER_EH2_H__
+
+/**
+* include files
+*/
+
+/**
+* definitions
+*/
+
+/**
+* types
+*/
+/* Barrier of a group of harts */
+typedef struct pspBarrier
+{
+  volatile u32_t uiNumOfArrived;                       /* Harts that arrived in the current round */
+  volatile u32_t uiSense;                              /* Flipped by the last hart to arrive */
+  u32_t          uiNumOfHarts;                         /* Harts in the group */
+  u32_t          uiHartSense[D_PSP_NUM_OF_HARTS];      /* Sense of the current round of each hart */
+} pspBarrier_t;
+
+/* Body of a parallel-for. Handles the indices uiFirst..uiEnd-1 */
+typedef void (*fptrPspParallelForBody_t)(u32_t uiFirst, u32_t uiEnd, void* pArg);
+
+/**
+* local prototypes
+*/
+
+/**
+* external prototypes
+*/
+
+/**
+* macros
+*/
+
+/**
+* global variables
+*/
+
+/**
+* APIs
+*/
+
+/**
+* @brief - Initialize a barrier. Must be done before any hart waits on it
+*
+* @parameter - pBarrier     - the barrier
+* @parameter - uiNumOfHarts - number of harts that wait on the barrier. M_PSP_MACHINE_GET_NUM_OF_HARTS()
+*                             for all the harts of the core
+*
+* @return    - none
+*/
+void pspBarrierInit(pspBarrier_t* pBarrier, u32_t uiNumOfHarts);
+
+/**
+* @brief - Wait until all the harts of the group arrive at the barrier
+*
+* @parameter - pBarrier - the barrier
+*
+* @return    - none
+*/
+void pspBarrierWait(pspBarrier_t* pBarrier);
+
+/**
+* @brief - Split the index range uiFirst..uiEnd-1 into one contiguous chunk per hart of the
+*          core, run the body on the chunk of the current hart and wait for the other harts
+*          to finish theirs. Must be called by all the harts of the core with the same arguments
+*
+* @parameter - pBarrier - barrier of all the harts of the core
+* @parameter - uiFirst  - first index
+* @parameter - uiEnd    - index that follows the last index
+* @parameter - fptrBody - body to run on the chunk of the current hart
+* @parameter - pArg     - argument to pass to the body
+*
+* @return    - none
+*/
+void pspParallelFor(pspBarrier_t* pBarrier, u32_t uiFirst, u32_t uiEnd, fptrPspParallelForBody_t fptrBody, void* pArg);
+
+#endif /* __PSP_BARRIER_EH2_H__ */
@@ -0,0 +1,409 @@
+/*
+* SPDX-License-Identifier: Apache-2.0
+* Copyright 2026 Western Digital Corporation or its affiliates.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http:*www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+/**
+* @file   psp_bitmanip.h
+* @author Western Digital
+* @date   16.10.2026
+* @brief  The file supplies portable bit-manipulation intrinsics for all the cores.
+*         Each intrinsic uses the bit-manipulation command when the target -march has
+*         the extension (the compiler defines __riscv_zbb, __riscv_zbc etc.) and a C
+*         fallback otherwise, so generic code needs no core specific #ifdef.
+*         The Zbs and Zba operations are plain C - the compiler emits bset/bclr/binv/bext
+*         and sh1add/sh2add/sh3add for them when the target has these extensions
+*/
+#ifndef  __PSP_BITMANIP_H__
+#define  __PSP_BITMANIP_H__
+
+/**
+* include files
+*/
+
+/**
+* definitions
+*/
+/* Extensions of the target, as set by -march */
+#ifdef __riscv_zbb
+  #define D_PSP_BITMANIP_HAS_ZBB
+#endif
+#ifdef __riscv_zbc
+  #define D_PSP_BITMANIP_HAS_ZBC
+#endif
+
+#define D_PSP_BITMANIP_WORD_BITS        32
+
+/**
+* types
+*/
+
+/**
+* local prototypes
+*/
+
+/**
+* external prototypes
+*/
+
+/**
+* macros
+*/
+#define M_PSP_BITMANIP_BIT_POSITION(uiPosition)   ((uiPosition) & (D_PSP_BITMANIP_WORD_BITS - 1))
+
+/**
+* global variables
+*/
+
+/**
+* APIs
+*/
+
+/**
+* @brief - Count the leading zeros (clz)
+*
+* @parameter - uiValue - the value
+*
+* @return    - number of zero-bits above the most significant '1' bit. 32 for 0
+*/
+D_PSP_ALWAYS_INLINE u32_t pspBitmanipClz(u32_t uiValue)
+{
+#ifdef D_PSP_BITMANIP_HAS_ZBB
+  /* The compiler folds the check for 0 into the clz command */
+  return (0 == uiValue) ? D_PSP_BITMANIP_WORD_BITS : (u32_t)__builtin_clz(uiValue);
+#else
+  u32_t uiZeros = 0;
+
+  if (0 == uiValue)
+  {
+    return D_PSP_BITMANIP_WORD_BITS;
+  }
+  if (0 == (uiValue & 0xFFFF0000))
+  {
+    uiZeros += 16;
+    uiValue <<= 16;
+  }
+  if (0 == (uiValue & 0xFF000000))
+  {
+    uiZeros += 8;
+    uiValue <<= 8;
+  }
+  if (0 == (uiValue & 0xF0000000))
+  {
+    uiZeros += 4;
+    uiValue <<= 4;
+  }
+  if (0 == (uiValue & 0xC0000000))
+  {
+    uiZeros += 2;
+    uiValue <<= 2;
+  }
+  if (0 == (uiValue & 0x80000000))
+  {
+    uiZeros += 1;
+  }
+
+  return uiZeros;
+#endif /* D_PSP_BITMANIP_HAS_ZBB */
+}
+
+/**
+* @brief - Count the trailing zeros (ctz)
+*
+* @parameter - uiValue - the value
+*
+* @return    - number of zero-bits below the least significant '1' bit. 32 for 0
+*/
+D_PSP_ALWAYS_INLINE u32_t pspBitmanipCtz(u32_t uiValue)
+{
+#ifdef D_PSP_BITMANIP_HAS_ZBB
+  return (0 == uiValue) ? D_PSP_BITMANIP_WORD_BITS : (u32_t)__builtin_ctz(uiValue);
+#else
+  u32_t uiZeros = 0;
+
+  if (0 == uiValue)
+  {
+    return D_PSP_BITMANIP_WORD_BITS;
+  }
+  if (0 == (uiValue & 0x0000FFFF))
+  {
+    uiZeros += 16;
+    uiValue >>= 16;
+  }
+  if (0 == (uiValue & 0x000000FF))
+  {
+    uiZeros += 8;
+    uiValue >>= 8;
+  }
+  if (0 == (uiValue & 0x0000000F))
+  {
+    uiZeros += 4;
+    uiValue >>= 4;
+  }
+  if (0 == (uiValue & 0x00000003))
+  {
+    uiZeros += 2;
+    uiValue >>= 2;
+  }
+  if (0 == (uiValue & 0x00000001))
+  {
+    uiZeros += 1;
+  }
+
+  return uiZeros;
+#endif /* D_PSP_BITMANIP_HAS_ZBB */
+}
+
+/**
+* @brief - Count the '1' bits (cpop)
+*
+* @parameter - uiValue - the value
+*
+* @return    - number of '1' bits
+*/
+D_PSP_ALWAYS_INLINE u32_t pspBitmanipPopcount(u32_t uiValue)
+{
+#ifdef D_PSP_BITMANIP_HAS_ZBB
+  return (u32_t)__builtin_popcount(uiValue);
+#else
+  /* Sum the bits in pairs, nibbles and bytes, then add the bytes with a multiplication */
+  uiValue = uiValue - ((uiValue >> 1) & 0x55555555);
+  uiValue = (uiValue & 0x33333333) + ((uiValue >> 2) & 0x33333333);
+  uiValue = (uiValue + (uiValue >> 4)) & 0x0F0F0F0F;
+
+  return (uiValue * 0x01010101) >> 24;
+#endif /* D_PSP_BITMANIP_HAS_ZBB */
+}
+
+/**
+* @brief - Reverse the order of the bytes (rev8)
+*
+* @parameter - uiValue - the value
+*
+* @return    - the value with its bytes swapped
+*/
+D_PSP_ALWAYS_INLINE u32_t pspBitmanipRev8(u32_t uiValue)
+{
+#ifdef D_PSP_BITMANIP_HAS_ZBB
+  return __builtin_bswap32(uiValue);
+#else
+  return (uiValue >> 24) | ((uiValue >> 8) & 0x0000FF00) | ((uiValue << 8) & 0x00FF0000) | (uiValue << 24);
+#endif /* D_PSP_BITMANIP_HAS_ZBB */
+}
+
+/**
+* @brief - Bitwise OR-combine of each byte (orc.b)
+*
+* @parameter - uiValue - the value
+*
+* @return    - each byte is 0xFF if the byte of the value is not 0, and 0 otherwise
+*/
+D_PSP_ALWAYS_INLINE u32_t pspBitmanipOrcB(u32_t uiValue)
+{
+  u32_t uiResult;
+
+#ifdef D_PSP_BITMANIP_HAS_ZBB
+  asm ("orc.b %0, %1" : "=r"(uiResult) : "r"(uiValue));
+#else
+  /* Bit 7 of a byte is set if any of its lower 7 bits is set (no carry to the next byte) or
+   * if it is set in the value. Then spread it over the byte */
+  uiResult = (((uiValue & 0x7F7F7F7F) + 0x7F7F7F7F) | uiValue) & 0x80808080;
+  uiResult = (uiResult >> 7) * 0xFF;
+#endif /* D_PSP_BITMANIP_HAS_ZBB */
+
+  return uiResult;
+}
+
+/**
+* @brief - Set a single bit (bset)
+*
+* @parameter - uiValue    - the value
+* @parameter - uiPosition - bit to set. Only the lower 5 bits are used
+*
+* @return    - the value with the bit set
+*/
+D_PSP_ALWAYS_INLINE u32_t pspBitmanipBitSet(u32_t uiValue, u32_t uiPosition)
+{
+  return uiValue | (1U << M_PSP_BITMANIP_BIT_POSITION(uiPosition));
+}
+
+/**
+* @brief - Clear a single bit (bclr)
+*
+* @parameter - uiValue    - the value
+* @parameter - uiPosition - bit to clear. Only the lower 5 bits are used
+*
+* @return    - the value with the bit cleared
+*/
+D_PSP_ALWAYS_INLINE u32_t pspBitmanipBitClear(u32_t uiValue, u32_t uiPosition)
+{
+  return uiValue & ~(1U << M_PSP_BITMANIP_BIT_POSITION(uiPosition));
+}
+
+/**
+* @brief - Invert a single bit (binv)
+*
+* @parameter - uiValue    - the value
+* @parameter - uiPosition - bit to invert. Only the lower 5 bits are used
+*
+* @return    - the value with the bit inverted
+*/
+D_PSP_ALWAYS_INLINE u32_t pspBitmanipBitInvert(u32_t uiValue, u32_t uiPosition)
+{
+  return uiValue ^ (1U << M_PSP_BITMANIP_BIT_POSITION(uiPosition));
+}
+
+/**
+* @brief - Extract a single bit (bext)
+*
+* @parameter - uiValue    - the value
+* @parameter - uiPosition - bit to extract. Only the lower 5 bits are used
+*
+* @return    - the bit - 0 or 1
+*/
+D_PSP_ALWAYS_INLINE u32_t pspBitmanipBitExtract(u32_t uiValue, u32_t uiPosition)
+{
+  return (uiValue >> M_PSP_BITMANIP_BIT_POSITION(uiPosition)) & 1;
+}
+
+/**
+* @brief - Shift left by 1 and add (sh1add) - address of a 16-bit element
+*
+* @parameter - uiIndex - the shifted value
+* @parameter - uiBase  - the added value
+*
+* @return    - (uiIndex << 1) + uiBase
+*/
+D_PSP_ALWAYS_INLINE u32_t pspBitmanipSh1Add(u32_t uiIndex, u32_t uiBase)
+{
+  return (uiIndex << 1) + uiBase;
+}
+
+/**
+* @brief - Shift left by 2 and add (sh2add) - address of a 32-bit element
+*
+* @parameter - uiIndex - the shifted value
+* @parameter - uiBase  - the added value
+*
+* @return    - (uiIndex << 2) + uiBase
+*/
+D_PSP_ALWAYS_INLINE u32_t pspBitmanipSh2Add(u32_t uiIndex, u32_t uiBase)
+{
+  return (uiIndex << 2) + uiBase;
+}
+
+/**
+* @brief - Shift left by 3 and add (sh3add) - address of a 64-bit element
+*
+* @parameter - uiIndex - the shifted value
+* @parameter - uiBase  - the added value
+*
+* @return    - (uiIndex << 3) + uiBase
+*/
+D_PSP_ALWAYS_INLINE u32_t pspBitmanipSh3Add(u32_t uiIndex, u32_t uiBase)
+{
+  return (uiIndex << 3) + uiBase;
+}
+
+/**
+* @brief - Lower half of the carry-less product (clmul)
+*
+* @parameter - uiValue1 - the first operand
+* @parameter - uiValue2 - the second operand
+*
+* @return    - bits 31..0 of the 64-bit carry-less product
+*/
+D_PSP_ALWAYS_INLINE u32_t pspBitmanipClmul(u32_t uiValue1, u32_t uiValue2)
+{
+  u32_t uiResult;
+
+#ifdef D_PSP_BITMANIP_HAS_ZBC
+  asm ("clmul %0, %1, %2" : "=r"(uiResult) : "r"(uiValue1), "r"(uiValue2));
+#else
+  u32_t uiBit;
+
+  uiResult = 0;
+  for (uiBit = 0; uiBit < D_PSP_BITMANIP_WORD_BITS; uiBit++)
+  {
+    if (0 != ((uiValue2 >> uiBit) & 1))
+    {
+      uiResult ^= uiValue1 << uiBit;
+    }
+  }
+#endif /* D_PSP_BITMANIP_HAS_ZBC */
+
+  return uiResult;
+}
+
+/**
+* @brief - Upper half of the carry-less product (clmulh)
+*
+* @parameter - uiValue1 - the first operand
+* @parameter - uiValue2 - the second operand
+*
+* @return    - bits 63..32 of the 64-bit carry-less product
+*/
+D_PSP_ALWAYS_INLINE u32_t pspBitmanipClmulh(u32_t uiValue1, u32_t uiValue2)
+{
+  u32_t uiResult;
+
+#ifdef D_PSP_BITMANIP_HAS_ZBC
+  asm ("clmulh %0, %1, %2" : "=r"(uiResult) : "r"(uiValue1), "r"(uiValue2));
+#else
+  u32_t uiBit;
+
+  uiResult = 0;
+  for (uiBit = 1; uiBit < D_PSP_BITMANIP_WORD_BITS; uiBit++)
+  {
+    if (0 != ((uiValue2 >> uiBit) & 1))
+    {
+      uiResult ^= uiValue1 >> (D_PSP_BITMANIP_WORD_BITS - uiBit);
+    }
+  }
+#endif /* D_PSP_BITMANIP_HAS_ZBC */
+
+  return uiResult;
+}
+
+/**
+* @brief - Reversed carry-less product (clmulr)
+*
+* @parameter - uiValue1 - the first operand
+* @parameter - uiValue2 - the second operand
+*
+* @return    - bits 62..31 of the 64-bit carry-less product
+*/
+D_PSP_ALWAYS_INLINE u32_t pspBitmanipClmulr(u32_t uiValue1, u32_t uiValue2)
+{
+  u32_t uiResult;
+
+#ifdef D_PSP_BITMANIP_HAS_ZBC
+  asm ("clmulr %0, %1, %2" : "=r"(uiResult) : "r"(uiValue1), "r"(uiValue2));
+#else
+  u32_t uiBit;
+
+  uiResult = 0;
+  for (uiBit = 0; uiBit < D_PSP_BITMANIP_WORD_BITS; uiBit++)
+  {
+    if (0 != ((uiValue2 >> uiBit) & 1))
+    {
+      uiResult ^= uiValue1 >> (D_PSP_BITMANIP_WORD_BITS - 1 - uiBit);
+    }
+  }
+#endif /* D_PSP_BITMANIP_HAS_ZBC */
+
+  return uiResult;
+}
+
+#endif /* __PSP_BITMANIP_H__ */
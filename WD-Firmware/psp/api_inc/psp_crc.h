@@ -0,0 +1,103 @@
+/*
+* SPDX-License-Identifier: Apache-2.0
+* Copyright 2026 Western Digital Corporation or its affiliates.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http:*www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+/**
+* @file   psp_crc.h
+* @author Western Digital
+* @date   16.10.2026
+* @brief  The file defines the PSP CRC32 and CRC32C APIs.
+*         A word is processed per step. With the carry-less multiply commands of the
+*         bit-manipulation extension (Zbc) each step is a Barrett reduction; otherwise
+*         it is a slice-by-4 table lookup (the tables are built by pspCrcInit)
+*/
+#ifndef  __PSP_CRC_H__
+#define  __PSP_CRC_H__
+
+/**
+* include files
+*/
+
+/**
+* definitions
+*/
+/* Selection of the CRC engine: the carry-less multiply engine is used when the target
+ * has the Zbc extension, unless the build defines D_PSP_CRC_USE_TABLE */
+#if defined(D_PSP_BITMANIP_HAS_ZBC) && !defined(D_PSP_CRC_USE_TABLE)
+  #define D_PSP_CRC_USE_CLMUL
+#endif
+
+#define D_PSP_CRC32_POLY               0x04C11DB7   /* CRC32 polynomial (without the x^32 term) */
+#define D_PSP_CRC32C_POLY              0x1EDC6F41   /* CRC32C (Castagnoli) polynomial (without the x^32 term) */
+#define D_PSP_CRC_INIT                 0xFFFFFFFF   /* Typical initial value */
+
+/**
+* types
+*/
+
+/**
+* local prototypes
+*/
+
+/**
+* external prototypes
+*/
+
+/**
+* macros
+*/
+
+/**
+* global variables
+*/
+
+/**
+* APIs
+*/
+
+/**
+* @brief - Initialize the CRC engine. Builds the slice-by-4 tables when the table engine
+*          is used. Must be called before the CRC APIs are used
+*
+* @return - none
+*/
+void pspCrcInit(void);
+
+/**
+* @brief - Calculate the CRC32 of a buffer - polynomial 0x04C11DB7, not reflected, no final
+*          xor (the same as xcrc32 of libiberty). The CRC of data split across buffers is
+*          calculated by passing the result of each call as the initial value of the next
+*
+* @parameter - pBuffer       - the buffer
+* @parameter - uiSizeInBytes - size of the buffer
+* @parameter - uiInit        - initial value, typically D_PSP_CRC_INIT
+*
+* @return - the CRC
+*/
+u32_t pspCrc32(const void* pBuffer, u32_t uiSizeInBytes, u32_t uiInit);
+
+/**
+* @brief - Calculate the CRC32C (Castagnoli) of a buffer - polynomial 0x1EDC6F41, reflected,
+*          no final xor. The standard CRC32C is ~pspCrc32c(pBuffer, uiSizeInBytes, D_PSP_CRC_INIT)
+*
+* @parameter - pBuffer       - the buffer
+* @parameter - uiSizeInBytes - size of the buffer
+* @parameter - uiInit        - initial value, typically D_PSP_CRC_INIT
+*
+* @return - the CRC
+*/
+u32_t pspCrc32c(const void* pBuffer, u32_t uiSizeInBytes, u32_t uiInit);
+
+#endif /* __PSP_CRC_H__ */
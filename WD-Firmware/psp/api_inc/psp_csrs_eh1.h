@@ -66,6 +66,7 @@
 /* meihap CSR */
 #define D_PSP_MEIHAP_NUM             0xFC8      /* External interrupts handler address pointer  */
 #define D_PSP_MEIHAP_CLAIMID_MASK    0x000003FC /* bits 2..9   */
+#define D_PSP_MEIHAP_CLAIMID_SHIFT   2
 #define D_PSP_MEIHAP_BASE_MASK       0xFFFFFC00 /* bits 10..31 */
 
 /* meicpct CSR */
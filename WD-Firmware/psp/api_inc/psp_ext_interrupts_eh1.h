@@ -82,6 +82,11 @@
 #define D_PSP_EXT_INT_THRESHOLD_14      14
 #define D_PSP_EXT_INT_THRESHOLD_15      15
 
+/* Core interrupts masked by pspMachineExtInterruptsDisableToThreshold */
+#define D_PSP_EXT_INT_THRESHOLD_CORE_INTS_MASK  (D_PSP_MIE_MSIE_MASK | D_PSP_MIE_MTIE_MASK | \
+                                                 D_PSP_MIE_TIMER0_INT_ENABLE_MASK | D_PSP_MIE_TIMER1_INT_ENABLE_MASK | \
+                                                 D_PSP_MIE_CORR_ERR_INT_ENABLE_MASK)
+
 
 /**
 * types
@@ -235,6 +240,24 @@ void  pspMachineExtInterruptsSetThreshold(u32_t uiThreshold);
 */
 void  pspMachineExtInterruptsSetNestingPriorityThreshold(u32_t uiNestingPriorityThreshold);
 
+/*
+* This function masks the core interrupts and the external interrupts up to the given priority
+* threshold, leaving the external interrupts of a higher priority unmasked (mstatus.MIE is not changed)
+*
+* @param uiThreshold = priority threshold to be programmed to PIC
+* @param pOutPrevIntState = previous state of the threshold and the core interrupts
+* @return None
+*/
+void pspMachineExtInterruptsDisableToThreshold(u32_t uiThreshold, u32_t *pOutPrevIntState);
+
+/*
+* This function restores the state saved by pspMachineExtInterruptsDisableToThreshold
+*
+* @param uiPrevIntState = previous state of the threshold and the core interrupts
+* @return None
+*/
+void pspMachineExtInterruptsRestoreThreshold(u32_t uiPrevIntState);
+
 /*
 * This function get the current selected external interrupt (claim-id)
 *
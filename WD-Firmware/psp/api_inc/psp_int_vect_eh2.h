@@ -18,7 +18,7 @@
 * @file   psp_int_vect_eh2.h
 * @author Nati Rapaport
 * @date   12.07.2020
-* @brief  Define the interrupts vector tables of hart0 and hart1 in SweRV EH2
+* @brief  Define the interrupts vector table of hart0 and hart1 in SweRV EH2
 */
 #ifndef __PSP_INT_VECT_EH2_H__
 #define __PSP_INT_VECT_EH2_H__
@@ -38,13 +38,9 @@
 /**
 * definitions
 */
-#ifdef M_PSP_VECT_TABLE
-  #undef M_PSP_VECT_TABLE
-  /* Interrupt vector table */
-  /* In SweRV EH2 with single HW thread - only psp_vect_table_hart0 is used */
-  #define M_PSP_VECT_TABLE psp_vect_table_hart0
-#endif
-/* In SweRV EH2 with 2 HW thread - both psp_vect_table_hart0 psp_vect_table_hart1 are used */
+/* In SweRV EH2 both harts use the same interrupt vector table - M_PSP_VECT_TABLE (psp_vect_table).
+ * The vector table reaches the handlers of the current hart through mhartid.
+ * psp_vect_table_hart0 and psp_vect_table_hart1 are kept as aliases of psp_vect_table */
 #define M_PSP_VECT_TABLE_HART0 psp_vect_table_hart0
 #define M_PSP_VECT_TABLE_HART1 psp_vect_table_hart1
 
@@ -126,6 +126,27 @@ fptrPspInterruptHandler_t pspMachineInterruptsRegisterIsr(fptrPspInterruptHandle
 */
 fptrPspInterruptHandler_t pspMachineInterruptsRegisterExcpHandler(fptrPspInterruptHandler_t fptrInterruptHandler, u32_t uiExceptionCause);
 
+#ifdef D_PSP_STATIC_ISR
+/**
+* @brief - Well-known interrupt service routines called directly from the vector table when
+*          the PSP is built with D_PSP_STATIC_ISR. The PSP supplies weak versions that call
+*          the handler registered by pspMachineInterruptsRegisterIsr (by default, the exception
+*          handling selector for exceptions), so an application can bind an ISR at link time
+*          by defining the symbol.
+*          pspMachineInterruptsMTimer0Isr/pspMachineInterruptsMTimer1Isr are relevant only
+*          for SweRV internal timers.
+*
+* @parameter - none
+* @return    - none
+*/
+void pspMachineInterruptsExceptionIsr(void);
+void pspMachineInterruptsMSoftIsr(void);
+void pspMachineInterruptsMTimerIsr(void);
+void pspMachineInterruptsMExternIsr(void);
+void pspMachineInterruptsMTimer0Isr(void);
+void pspMachineInterruptsMTimer1Isr(void);
+#endif /* D_PSP_STATIC_ISR */
+
 /**
 * @brief - Set vector-table address at mtvec CSR
 *
@@ -0,0 +1,135 @@
+/*
+* SPDX-License-Identifier: Apache-2.0
+* Copyright 2026 Western Digital Corporation or its affiliates.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http:*www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+/**
+* @file   psp_ipi_eh2.h
+* @author Western Digital
+* @date   16.10.2026
+* @brief  The file defines the inter-hart messaging (IPI) service of SweRV EH2.
+*         A hart posts messages to the mailbox of another hart and rings its doorbell -
+*         the machine software interrupt of the target hart. The doorbell is coalesced:
+*         a burst of posts raises a single interrupt, and the target hart handles all
+*         the messages in its mailbox in that interrupt
+*/
+#ifndef  __PSP_IPI_EH2_H__
+#define  __PSP_IPI_EH2_H__
+
+/**
+* include files
+*/
+
+/**
+* definitions
+*/
+/* Number of messages in the mailbox of each hart. Must be a power of 2 */
+#ifndef D_PSP_IPI_MAILBOX_SIZE
+  #define D_PSP_IPI_MAILBOX_SIZE     16
+#endif
+
+/* Machine software interrupt (msip) register of hart0. The register of hart n is at
+ * D_PSP_IPI_MSIP_ADDRESS + n * D_PSP_IPI_MSIP_STRIDE */
+#ifndef D_PSP_IPI_MSIP_ADDRESS
+  #define D_PSP_IPI_MSIP_ADDRESS     D_SW_INT_ADDRESS
+#endif
+#ifndef D_PSP_IPI_MSIP_STRIDE
+  #define D_PSP_IPI_MSIP_STRIDE      4
+#endif
+
+/* Doorbell states */
+#define D_PSP_IPI_DOORBELL_IDLE      0
+#define D_PSP_IPI_DOORBELL_RUNG      1
+
+/**
+* types
+*/
+/* Handler of the messages received by a hart. Called in interrupt context */
+typedef void (*fptrPspIpiHandler_t)(u32_t uiMessage);
+
+/* Mailbox of a hart */
+typedef struct pspIpiMailbox
+{
+  pspRingMpsc_t       stRing;                              /* Posted messages */
+  pspRingSlot_t       stSlots[D_PSP_IPI_MAILBOX_SIZE];
+  u32_t               uiDoorbell;                          /* D_PSP_IPI_DOORBELL_RUNG - an interrupt is pending */
+  fptrPspIpiHandler_t fptrHandler;
+  u32_t               uiNumOfInterrupts;                   /* Statistics - interrupts taken */
+  u32_t               uiNumOfMessages;                     /* Statistics - messages handled */
+} pspIpiMailbox_t;
+
+/**
+* local prototypes
+*/
+
+/**
+* external prototypes
+*/
+
+/**
+* macros
+*/
+#define M_PSP_IPI_MSIP_REG(uiHartId)  (*(volatile u32_t*)(D_PSP_IPI_MSIP_ADDRESS + (uiHartId) * D_PSP_IPI_MSIP_STRIDE))
+
+/**
+* global variables
+*/
+
+/**
+* APIs
+*/
+
+/**
+* @brief - Initialize the mailbox of the current hart and enable its machine software
+*          interrupt. Must be called by each receiving hart before other harts post to it.
+*          The machine software interrupt is used by the IPI service only
+*
+* @parameter - fptrHandler - handler of the received messages. Called in interrupt context
+*
+* @return    - none
+*/
+void pspIpiInit(fptrPspIpiHandler_t fptrHandler);
+
+/**
+* @brief - Post a message to the mailbox of a hart and ring its doorbell
+*
+* @parameter - uiTargetHart - hart to post to
+* @parameter - uiMessage    - the message
+*
+* @return    - D_PSP_SUCCESS, D_PSP_FAIL - the mailbox is full
+*/
+u32_t pspIpiPost(u32_t uiTargetHart, u32_t uiMessage);
+
+/**
+* @brief - Post a batch of messages to the mailbox of a hart and ring its doorbell once
+*
+* @parameter - uiTargetHart    - hart to post to
+* @parameter - pMessages       - the messages
+* @parameter - uiNumOfMessages - number of messages
+*
+* @return    - number of messages posted. Less than uiNumOfMessages when the mailbox is full
+*/
+u32_t pspIpiPostBatch(u32_t uiTargetHart, const u32_t* pMessages, u32_t uiNumOfMessages);
+
+/**
+* @brief - Get the statistics of the mailbox of the current hart
+*
+* @parameter - pNumOfInterrupts - output - number of IPI interrupts taken
+* @parameter - pNumOfMessages   - output - number of messages handled
+*
+* @return    - none
+*/
+void pspIpiGetStats(u32_t* pNumOfInterrupts, u32_t* pNumOfMessages);
+
+#endif /* __PSP_IPI_EH2_H__ */
@@ -123,10 +123,20 @@
 #define M_PSP_WRITE_CSR(csr, val)                     _WRITE_CSR_INTERMEDIATE_(csr, val)
 #define M_PSP_SET_CSR(csr, bits)                      _SET_CSR_INTERMEDIATE_(csr, bits)
 #define M_PSP_CLEAR_CSR(csr, bits)                    _CLEAR_CSR_INTERMEDIATE_(csr, bits)
-#define M_PSP_SWAP_CSR(read_val, csr, write_val)      _SWAP_CSR_INTERMEDIATE_(csr, val)
+#define M_PSP_SWAP_CSR(read_val, csr, write_val)      _SWAP_CSR_INTERMEDIATE_(read_val, csr, write_val)
 #define M_PSP_READ_AND_SET_CSR(read_val, csr, bits)   _READ_AND_SET_CSR_INTERMEDIATE_(read_val, csr, bits)
 #define M_PSP_READ_AND_CLEAR_CSR(read_val, csr, bits) _READ_AND_CLEAR_CSR_INTERMEDIATE_(read_val, csr, bits)
 
+/* Read a 64-bit counter that is split between two CSRs (RV32). The high part is read before
+ * and after the low part; if it changed, the low part wrapped in between and is read again */
+#define M_PSP_READ_CSR64(csrLow, csrHigh) ({ \
+  u32_t _uiHigh_, _uiLow_; \
+  do { \
+    _uiHigh_ = M_PSP_READ_CSR(csrHigh); \
+    _uiLow_  = M_PSP_READ_CSR(csrLow); \
+  } while (_uiHigh_ != M_PSP_READ_CSR(csrHigh)); \
+  (((u64_t)_uiHigh_ << D_PSP_SHIFT_32) | _uiLow_); })
+
 /*****************************************************************************************/
 #define M_PSP_EBREAK()              asm volatile ("ebreak" : : : );
 #define M_PSP_ECALL()               asm volatile ("ecall" : : : );
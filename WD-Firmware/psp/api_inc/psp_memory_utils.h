@@ -67,4 +67,60 @@
 */
 void* pspMemsetBytes(void* pMemory, s08_t siVal, u32_t uiSizeInBytes);
 
+/**
+* @brief - PSP implementation of memset function. The words between the first and the last
+*          word boundaries are set in an unrolled loop
+*
+* @parameter - address of the memory to be set
+* @parameter - value to set (the lower byte is used)
+* @parameter - number of bytes to set
+*
+* @return - address of the memory that has been set
+*/
+void* pspMemset(void* pMemory, u32_t uiVal, u32_t uiSizeInBytes);
+
+/**
+* @brief - PSP implementation of memcpy function. The memory areas must not overlap
+*
+* @parameter - address of the destination
+* @parameter - address of the source
+* @parameter - number of bytes to copy
+*
+* @return - address of the destination
+*/
+void* pspMemcpy(void* pDestination, const void* pSource, u32_t uiSizeInBytes);
+
+/**
+* @brief - PSP implementation of memmove function. The memory areas may overlap
+*
+* @parameter - address of the destination
+* @parameter - address of the source
+* @parameter - number of bytes to copy
+*
+* @return - address of the destination
+*/
+void* pspMemmove(void* pDestination, const void* pSource, u32_t uiSizeInBytes);
+
+/**
+* @brief - PSP implementation of memcmp function
+*
+* @parameter - address of the first memory area
+* @parameter - address of the second memory area
+* @parameter - number of bytes to compare
+*
+* @return - 0 if the areas are equal. Otherwise the difference of the first differing bytes
+*           (as unsigned bytes) - negative if the byte of the first area is smaller
+*/
+s32_t pspMemcmp(const void* pMemory1, const void* pMemory2, u32_t uiSizeInBytes);
+
+/**
+* @brief - PSP implementation of strlen function. The string is scanned a word at a time
+*          (with orc.b when the core supports the bit-manipulation extension)
+*
+* @parameter - address of the string
+*
+* @return - number of characters before the terminating zero
+*/
+u32_t pspStrlen(const char* pString);
+
 #endif /* __PSP_MEMORY_UTILS_H__ */
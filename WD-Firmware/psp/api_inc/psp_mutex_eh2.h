@@ -24,6 +24,11 @@
 * has to provide memory for a required number of mutexes by calling
 * pspMutexHeapInit. The user also has to initialize mutexes for internal
 * use by calling pspMutexInitPspMutexes.
+* The lock algorithm is selected per mutex (pspMutexCreateByType).
+* For state that is read far more often than it is written, the file also
+* defines a reader-writer spin-lock, a sequence lock (seqlock) and a 64-bit
+* counter that is read without tearing. These are embedded in the user data and
+* are not taken from the mutexs-heap.
 */
 #ifndef __PSP_MUTEX_EH2_H__
 #define __PSP_MUTEX_EH2_H__
@@ -40,15 +45,77 @@
 #define D_PSP_MUTEX_LOCKED      1
 #define D_PSP_MUTEX_UNLOCKED    0
 
+/* Type of the mutexes created by pspMutexCreate */
+#ifndef D_PSP_MUTEX_DEFAULT_TYPE
+  #define D_PSP_MUTEX_DEFAULT_TYPE  E_PSP_MUTEX_TYPE_TEST_AND_SET
+#endif
+
+/* Maximal number of mutexs in the mutexs-heap (size of the free bitmap). Up to 1024 */
+#ifndef D_PSP_MUTEX_HEAP_MAX_MUTEXES
+  #define D_PSP_MUTEX_HEAP_MAX_MUTEXES  256
+#endif
+
+/* When D_PSP_MUTEX_CB_LINE_SIZE is defined, each mutex control block is padded and aligned
+ * to that size, so harts spinning on neighbouring mutexs do not share a cache line */
+#ifdef D_PSP_MUTEX_CB_LINE_SIZE
+  #define D_PSP_MUTEX_CB_ALIGNMENT  D_PSP_ALIGNED(D_PSP_MUTEX_CB_LINE_SIZE)
+#else
+  #define D_PSP_MUTEX_CB_ALIGNMENT
+#endif
+
+/* Reader-writer lock state: the writer bit and the number of readers holding the lock */
+#define D_PSP_MUTEX_RW_WRITER        0x80000000
+#define D_PSP_MUTEX_RW_READERS_MASK  0x7FFFFFFF
+
 /**
 * types
 */
+/* Mutex lock algorithms */
+typedef enum pspMutexType
+{
+  E_PSP_MUTEX_TYPE_TEST_AND_SET = 0,  /* AMO swap spin-lock with bounded exponential backoff. Not fair */
+  E_PSP_MUTEX_TYPE_TICKET       = 1,  /* Ticket lock - FIFO order, backoff in proportion to the waiters ahead */
+  E_PSP_MUTEX_TYPE_QUEUE        = 2,  /* Queue (MCS-style) lock - FIFO order, each hart spins on its own flag.
+                                         Available when the PSP is built with D_PSP_MUTEX_QUEUE_LOCK */
+  E_PSP_MUTEX_TYPE_LAST
+} ePspMutexType_t;
+
 typedef struct pspMutexControlBlock
 {
-   u32_t  uiMutexState;        /* D_PSP_MUTEX_LOCKED / D_PSP_MUTEX_UNLOCKED */
+   u32_t  uiMutexState;        /* Test-and-set: D_PSP_MUTEX_LOCKED / D_PSP_MUTEX_UNLOCKED.
+                                  Ticket: next ticket (bits 16..31) and now serving (bits 0..15).
+                                  Queue: hart id + 1 of the last hart in the queue. 0 - unlocked */
    u32_t  uiMutexOccupied :1;  /* D_PSP_MUTEX_OCCUIPED / D_PSP_MUTEX_UNOCCUIPED */
    u32_t  uiMutexCreator  :1;  /* Created by: 0 - Hart0 / 1 - Hart1 .  Only the creator is allowed to destroy */
-} pspMutexCb_t;
+   u32_t  uiMutexType     :2;  /* ePspMutexType_t */
+#ifdef D_PSP_MUTEX_QUEUE_LOCK
+   u32_t  uiQueueNext[D_PSP_NUM_OF_HARTS];  /* Queue: successor of each hart in the queue (hart id + 1). 0 - none */
+   u32_t  uiQueueWait[D_PSP_NUM_OF_HARTS];  /* Queue: each hart spins on its own flag until the lock is handed over */
+#endif /* D_PSP_MUTEX_QUEUE_LOCK */
+} D_PSP_MUTEX_CB_ALIGNMENT pspMutexCb_t;
+
+/* Reader-writer spin-lock. Readers do not serialize against each other. A waiting
+ * writer blocks new readers, so the writer is not starved */
+typedef struct pspMutexRw
+{
+   volatile u32_t uiRwState;   /* D_PSP_MUTEX_RW_WRITER - a writer holds or waits for the lock.
+                                  D_PSP_MUTEX_RW_READERS_MASK - number of readers */
+} pspMutexRw_t;
+
+/* Sequence lock. The writers never wait for the readers - a reader retries its
+ * read section when a write overlapped it */
+typedef struct pspMutexSeq
+{
+   volatile u32_t uiSequence;  /* Odd - a write is in progress */
+} pspMutexSeq_t;
+
+/* 64-bit counter that is updated and read without tearing, on top of a sequence lock */
+typedef struct pspMutexCounter64
+{
+   pspMutexSeq_t  stSeq;
+   volatile u32_t uiLow;
+   volatile u32_t uiHigh;
+} pspMutexCounter64_t;
 
 /**
 * local prototypes
@@ -80,13 +147,13 @@ void pspMutexInitPspMutexs(void);
 * @brief - Initialize (zero) heap of mutexs.
 * 
 * @parameter - Address of the mutexs heap
-* @parameter - Number of mutexs in the heap
+* @parameter - Number of mutexs in the heap (up to D_PSP_MUTEX_HEAP_MAX_MUTEXES)
 *
 */
 void pspMutexHeapInit(pspMutexCb_t* pMutexHeapAddress, u32_t uiNumOfMutexs);
 
 /**
-* @brief - Create a mutex in the mutexs-heap.
+* @brief - Create a mutex in the mutexs-heap, with the lock algorithm D_PSP_MUTEX_DEFAULT_TYPE.
 *          - Mark it as 'occupied'
 *          - Mark the hart that created it
 *
@@ -94,6 +161,17 @@ void pspMutexHeapInit(pspMutexCb_t* pMutexHeapAddress, u32_t uiNumOfMutexs);
 */
 pspMutexCb_t* pspMutexCreate(void);
 
+/**
+* @brief - Create a mutex in the mutexs-heap, with a given lock algorithm.
+*          - Mark it as 'occupied'
+*          - Mark the hart that created it
+*
+* @parameter - Lock algorithm of the mutex (E_PSP_MUTEX_TYPE_XXX)
+*
+* @return - Address of the created mutex. In case of failure return NULL.
+*/
+pspMutexCb_t* pspMutexCreateByType(u32_t uiMutexType);
+
 /**
 * @brief - Destroy (remove the 'occupied' mark) a mutex in the mutexs-heap
 *
@@ -119,5 +197,114 @@ void pspMutexAtomicLock(pspMutexCb_t* pMutex);
 */
 void pspMutexAtomicUnlock(pspMutexCb_t* pMutex);
 
+/**
+* @brief - Initialize a reader-writer lock to unlocked
+*
+* @parameter - pointer to the reader-writer lock
+*
+*/
+void pspMutexRwInit(pspMutexRw_t* pRwLock);
+
+/**
+* @brief - Lock a reader-writer lock for read. Other readers may hold the lock at the same time
+*
+* @parameter - pointer to the reader-writer lock
+*
+*/
+void pspMutexRwReadLock(pspMutexRw_t* pRwLock);
+
+/**
+* @brief - Unlock a reader-writer lock that was locked for read
+*
+* @parameter - pointer to the reader-writer lock
+*
+*/
+void pspMutexRwReadUnlock(pspMutexRw_t* pRwLock);
+
+/**
+* @brief - Lock a reader-writer lock for write. Waits until the readers that hold the lock release it
+*
+* @parameter - pointer to the reader-writer lock
+*
+*/
+void pspMutexRwWriteLock(pspMutexRw_t* pRwLock);
+
+/**
+* @brief - Unlock a reader-writer lock that was locked for write
+*
+* @parameter - pointer to the reader-writer lock
+*
+*/
+void pspMutexRwWriteUnlock(pspMutexRw_t* pRwLock);
+
+/**
+* @brief - Initialize a sequence lock
+*
+* @parameter - pointer to the sequence lock
+*
+*/
+void pspMutexSeqInit(pspMutexSeq_t* pSeqLock);
+
+/**
+* @brief - Start a write section of a sequence lock. Writers exclude each other
+*
+* @parameter - pointer to the sequence lock
+*
+*/
+void pspMutexSeqWriteBegin(pspMutexSeq_t* pSeqLock);
+
+/**
+* @brief - End a write section of a sequence lock
+*
+* @parameter - pointer to the sequence lock
+*
+*/
+void pspMutexSeqWriteEnd(pspMutexSeq_t* pSeqLock);
+
+/**
+* @brief - Start a read section of a sequence lock
+*
+* @parameter - pointer to the sequence lock
+*
+* @return    - sequence to pass to pspMutexSeqReadRetry
+*/
+u32_t pspMutexSeqReadBegin(pspMutexSeq_t* pSeqLock);
+
+/**
+* @brief - End a read section of a sequence lock
+*
+* @parameter - pointer to the sequence lock
+* @parameter - sequence returned by pspMutexSeqReadBegin
+*
+* @return    - D_PSP_TRUE - a write overlapped the read section, and it must be retried. D_PSP_FALSE - otherwise
+*/
+u32_t pspMutexSeqReadRetry(pspMutexSeq_t* pSeqLock, u32_t uiSequence);
+
+/**
+* @brief - Initialize a 64-bit counter to 0
+*
+* @parameter - pointer to the counter
+*
+*/
+void pspMutexCounter64Init(pspMutexCounter64_t* pCounter);
+
+/**
+* @brief - Add a value to a 64-bit counter. Can be called by any hart
+*
+* @parameter - pointer to the counter
+* @parameter - value to add
+*
+*/
+void pspMutexCounter64Add(pspMutexCounter64_t* pCounter, u32_t uiValue);
+
+/**
+* @brief - Read a 64-bit counter. The two halves are read from the same update
+*
+* @parameter - pointer to the counter
+*
+* @return    - value of the counter
+*/
+u64_t pspMutexCounter64Read(pspMutexCounter64_t* pCounter);
+
 
 #endif /* __PSP_MUTEX_EH2_H__ */
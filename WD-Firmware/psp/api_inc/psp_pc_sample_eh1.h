@@ -0,0 +1,141 @@
+/*
+* SPDX-License-Identifier: Apache-2.0
+* Copyright 2026 Western Digital Corporation or its affiliates.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http:*www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+/**
+* @file   psp_pc_sample_eh1.h
+* @author Western Digital
+* @date   16.10.2026
+* @brief  The file defines the PC-sampling profiler of SweRV cores. An internal timer
+*         interrupts the hart periodically and the interrupted pc (mepc), return address,
+*         context (e.g. the running task) and hart id are recorded into a ring buffer in
+*         DCCM. The samples are read by the application or dumped by the debugger, and
+*         symbolized on the host by psp/tools/psp_pc_sample_fold.py into folded stacks
+*         and a flame graph
+*/
+#ifndef  __PSP_PC_SAMPLE_EH1_H__
+#define  __PSP_PC_SAMPLE_EH1_H__
+
+/**
+* include files
+*/
+
+/**
+* definitions
+*/
+/* Number of samples in the ring buffer of a hart - must be a power of 2 */
+#ifndef D_PSP_PC_SAMPLE_BUFFER_SIZE
+  #define D_PSP_PC_SAMPLE_BUFFER_SIZE      256
+#endif
+
+/* Random cycles added to each sampling period, so the samples do not lock on a
+   loop of the same period. 0 - fixed period */
+#ifndef D_PSP_PC_SAMPLE_JITTER_MASK
+  #define D_PSP_PC_SAMPLE_JITTER_MASK      0xFF
+#endif
+
+#if (0 != (D_PSP_PC_SAMPLE_BUFFER_SIZE & (D_PSP_PC_SAMPLE_BUFFER_SIZE - 1)))
+  #error "D_PSP_PC_SAMPLE_BUFFER_SIZE must be a power of 2"
+#endif
+
+/**
+* types
+*/
+/* A sample. The layout is read by psp_pc_sample_fold.py */
+typedef struct pspPcSample
+{
+  u32_t uiPc;                /* Interrupted instruction */
+  u32_t uiRa;                /* Return address of the interrupted function (the caller, for a leaf function) */
+  u32_t uiContext;           /* Task or other context id, 0 when not given */
+  u32_t uiHartId;
+} pspPcSample_t;
+
+/* Get the register frame the interrupted code was saved to by the vector table, and the
+   context id. Needed when the vector table is not the PSP one - e.g. an RTOSAL application
+   returns the frame pointed by the control block of the current task and its handle */
+typedef pspStack_t* (*fptrPspPcSampleFrameGet_t)(u32_t* pContext);
+
+/* Ring buffer of a hart */
+typedef struct pspPcSampleBuffer
+{
+  u32_t uiNumOfWritten;                            /* Samples taken since start - the write index */
+  u32_t uiNumOfRead;                               /* Samples read or overwritten - the read index */
+  u32_t uiNumOfLost;                               /* Samples overwritten before they were read */
+  u32_t uiTimer;                                   /* Internal timer that samples the hart */
+  u32_t uiPeriodCycles;
+  u32_t uiJitterSeed;
+  fptrPspPcSampleFrameGet_t fptrFrameGet;
+  pspPcSample_t stSample[D_PSP_PC_SAMPLE_BUFFER_SIZE];
+} pspPcSampleBuffer_t;
+
+/**
+* local prototypes
+*/
+
+/**
+* external prototypes
+*/
+
+/**
+* macros
+*/
+
+/**
+* global variables
+*/
+
+/**
+* APIs
+*/
+
+/**
+* @brief - Clear the ring buffer of the current hart and start sampling it on an internal
+*          timer. The machine interrupts must be enabled by the caller
+*
+* @parameter - uiTimer        - D_PSP_INTERNAL_TIMER0 or D_PSP_INTERNAL_TIMER1
+* @parameter - uiPeriodCycles - sampling period in cycles
+* @parameter - fptrFrameGet   - frame and context of the interrupted code. NULL - the PSP
+*                               vector table, context 0
+* @return    - none
+*/
+void pspPcSampleStart(u32_t uiTimer, u32_t uiPeriodCycles, fptrPspPcSampleFrameGet_t fptrFrameGet);
+
+/**
+* @brief - Stop sampling the current hart. The samples stay in the ring buffer
+*
+* @parameter - none
+* @return    - none
+*/
+void pspPcSampleStop(void);
+
+/**
+* @brief - Take a sample of the interrupted code. Called from the internal timer interrupt
+*
+* @parameter - none
+* @return    - none
+*/
+void pspPcSampleTake(void);
+
+/**
+* @brief - Read the oldest unread samples of the current hart out of the ring buffer
+*
+* @parameter - pSamples      - output - up to uiMaxSamples samples, oldest first
+* @parameter - uiMaxSamples  - number of entries in pSamples
+* @parameter - pNumOfLost    - output - samples overwritten before they were read. May be NULL
+* @return    - number of samples read
+*/
+u32_t pspPcSampleRead(pspPcSample_t* pSamples, u32_t uiMaxSamples, u32_t* pNumOfLost);
+
+#endif /* __PSP_PC_SAMPLE_EH1_H__ */
@@ -42,6 +42,7 @@
 #define D_PSP_COUNTER1          M_PSP_BIT_MASK(4)
 #define D_PSP_COUNTER2          M_PSP_BIT_MASK(5)
 #define D_PSP_COUNTER3          M_PSP_BIT_MASK(6)
+#define D_PSP_NUM_OF_PERF_COUNTERS   7   /* Entries of a counters snapshot - one per counter bit */
 
 /*
  * Performance monitoring events
@@ -172,4 +173,19 @@ void pspMachinePerfCounterSet(u32_t uiCounter, u32_t uiEvent);
 */
 u64_t pspMachinePerfCounterGet(u32_t uiCounter);
 
+/**
+* @brief The function takes a snapshot of a set of counters. The counters are stopped while
+*        they are read, so all of them are taken at the same instant, and then resumed
+*        (the counters that were already stopped stay stopped)
+*
+* @param uiCounters   – bitmap of the counters to read (D_PSP_CYCLE_COUNTER, D_PSP_TIME_COUNTER,
+*                       D_PSP_INSTRET_COUNTER, D_PSP_COUNTER0..3)
+* @param pValues      – output - D_PSP_NUM_OF_PERF_COUNTERS entries. Entry n gets the value of
+*                       the counter of bit n. Entries of counters that are not in uiCounters
+*                       are not written
+*
+* @return No return value
+*/
+void pspMachinePerfCounterSnapshot(u32_t uiCounters, u64_t* pValues);
+
 #endif /* _PSP_PERFORMANCE_MONITOR_H_ */
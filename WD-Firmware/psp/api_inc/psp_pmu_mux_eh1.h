@@ -0,0 +1,146 @@
+/*
+* SPDX-License-Identifier: Apache-2.0
+* Copyright 2026 Western Digital Corporation or its affiliates.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http:*www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+/**
+* @file   psp_pmu_mux_eh1.h
+* @author Western Digital
+* @date   16.10.2026
+* @brief  The file defines the PMU event multiplexer of SweRV cores. The events are
+*         split into groups of four that take turns on the event counters (mhpmcounter3..6),
+*         rotated on a timer tick. The count of each event is scaled by the cycles its group
+*         was on the counters, so a single run of a workload gives an estimate of all the
+*         events. The multiplexer owns the event counters while it runs - it cannot be
+*         used together with the region profiling (psp_profile_eh1.h)
+*/
+#ifndef  __PSP_PMU_MUX_EH1_H__
+#define  __PSP_PMU_MUX_EH1_H__
+
+/**
+* include files
+*/
+
+/**
+* definitions
+*/
+/* Maximal number of multiplexed events */
+#ifndef D_PSP_PMU_MUX_MAX_EVENTS
+  #define D_PSP_PMU_MUX_MAX_EVENTS       64
+#endif
+
+/* Number of events counted at a time - mhpmcounter3..6 */
+#define D_PSP_PMU_MUX_GROUP_SIZE         4
+#define D_PSP_PMU_MUX_MAX_GROUPS         ((D_PSP_PMU_MUX_MAX_EVENTS + D_PSP_PMU_MUX_GROUP_SIZE - 1) / D_PSP_PMU_MUX_GROUP_SIZE)
+
+/* Event that counts nothing - programmed on the unused counters of the last group */
+#define D_PSP_PMU_MUX_NO_EVENT           0
+
+/**
+* types
+*/
+/* Result of an event */
+typedef struct pspPmuMuxResult
+{
+  u32_t uiEvent;
+  u64_t udCount;             /* Count while the event was on the counters */
+  u64_t udEnabledCycles;     /* Cycles the event was on the counters */
+  u64_t udScaledCount;       /* Estimated count over the whole run: udCount * total cycles / udEnabledCycles */
+} pspPmuMuxResult_t;
+
+/* Multiplexer state */
+typedef struct pspPmuMux
+{
+  u32_t uiEvent[D_PSP_PMU_MUX_MAX_EVENTS];
+  u64_t udCount[D_PSP_PMU_MUX_MAX_EVENTS];
+  u64_t udEnabledCycles[D_PSP_PMU_MUX_MAX_GROUPS];
+  u64_t udTotalCycles;
+  u32_t uiNumOfEvents;
+  u32_t uiNumOfGroups;
+  u32_t uiGroup;                                   /* Group on the counters */
+  u32_t uiGroupStartCycle;                         /* mcycle when the group was put on the counters */
+  u32_t uiGroupStartCount[D_PSP_PMU_MUX_GROUP_SIZE];
+  u32_t uiTimer;                                   /* Internal timer that rotates the groups */
+  u32_t uiNumOfRotations;
+} pspPmuMux_t;
+
+/**
+* local prototypes
+*/
+
+/**
+* external prototypes
+*/
+
+/**
+* macros
+*/
+
+/**
+* global variables
+*/
+
+/**
+* APIs
+*/
+
+/**
+* @brief - Set the events to multiplex and clear their counts
+*
+* @parameter - pEvents       - events (D_CYCLES_CLOCKS_ACTIVE etc.). NULL - all the events of the core
+* @parameter - uiNumOfEvents - number of events, up to D_PSP_PMU_MUX_MAX_EVENTS. Ignored when pEvents is NULL
+* @return    - number of multiplexed events
+*/
+u32_t pspPmuMuxInit(const u32_t* pEvents, u32_t uiNumOfEvents);
+
+/**
+* @brief - Put the first group on the counters and start rotating the groups on an
+*          internal timer tick. The machine interrupts must be enabled by the caller
+*
+* @parameter - uiTimer        - D_PSP_INTERNAL_TIMER0 or D_PSP_INTERNAL_TIMER1
+* @parameter - uiPeriodCycles - rotation period in cycles. Should be well below 2^31, so
+*                               an event count does not wrap within a period
+* @return    - none
+*/
+void pspPmuMuxStart(u32_t uiTimer, u32_t uiPeriodCycles);
+
+/**
+* @brief - Accumulate the counts of the group on the counters and put the next group on
+*          them. Called from the internal timer interrupt; can also be called from another
+*          periodic tick with interrupts disabled
+*
+* @parameter - none
+* @return    - none
+*/
+void pspPmuMuxRotate(void);
+
+/**
+* @brief - Stop rotating and accumulate the counts of the group on the counters
+*
+* @parameter - none
+* @return    - none
+*/
+void pspPmuMuxStop(void);
+
+/**
+* @brief - Get the results of the events
+*
+* @parameter - pResults       - output - uiMaxResults results, in the order of the events
+* @parameter - uiMaxResults   - number of entries in pResults
+* @parameter - pTotalCycles   - output - cycles of the whole run
+* @return    - number of results
+*/
+u32_t pspPmuMuxGetResults(pspPmuMuxResult_t* pResults, u32_t uiMaxResults, u64_t* pTotalCycles);
+
+#endif /* __PSP_PMU_MUX_EH1_H__ */
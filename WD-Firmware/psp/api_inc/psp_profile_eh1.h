@@ -0,0 +1,161 @@
+/*
+* SPDX-License-Identifier: Apache-2.0
+* Copyright 2026 Western Digital Corporation or its affiliates.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http:*www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+/**
+* @file   psp_profile_eh1.h
+* @author Western Digital
+* @date   16.10.2026
+* @brief  The file defines the PSP region profiling API of SweRV cores. A region is
+*         delimited by M_PSP_PROFILE_BEGIN(id) and M_PSP_PROFILE_END(id); the cycles,
+*         the retired instructions and the four programmed events it takes are
+*         accumulated per region-id. Regions may nest - each region counts the regions
+*         nested in it. Profiling is active only when the PSP is built with D_PSP_PROFILE,
+*         otherwise the macros are empty
+*/
+#ifndef  __PSP_PROFILE_EH1_H__
+#define  __PSP_PROFILE_EH1_H__
+
+/**
+* include files
+*/
+
+/**
+* definitions
+*/
+/* Number of region-ids */
+#ifndef D_PSP_PROFILE_NUM_OF_IDS
+  #define D_PSP_PROFILE_NUM_OF_IDS       16
+#endif
+
+/* Maximal nesting depth of regions. Deeper regions are not measured */
+#ifndef D_PSP_PROFILE_MAX_DEPTH
+  #define D_PSP_PROFILE_MAX_DEPTH        8
+#endif
+
+/* Measured counters - index in pspProfileStats_t.stCounter */
+#define D_PSP_PROFILE_CYCLES             0
+#define D_PSP_PROFILE_INSTRET            1
+#define D_PSP_PROFILE_EVENT0             2   /* D_PSP_COUNTER0 */
+#define D_PSP_PROFILE_EVENT1             3   /* D_PSP_COUNTER1 */
+#define D_PSP_PROFILE_EVENT2             4   /* D_PSP_COUNTER2 */
+#define D_PSP_PROFILE_EVENT3             5   /* D_PSP_COUNTER3 */
+#define D_PSP_PROFILE_NUM_OF_COUNTERS    6
+
+/**
+* macros
+*/
+#ifdef D_PSP_PROFILE
+  #define M_PSP_PROFILE_BEGIN(uiId)      pspProfileBegin(uiId)
+  #define M_PSP_PROFILE_END(uiId)        pspProfileEnd(uiId)
+#else
+  #define M_PSP_PROFILE_BEGIN(uiId)
+  #define M_PSP_PROFILE_END(uiId)
+#endif /* D_PSP_PROFILE */
+
+/**
+* types
+*/
+/* Statistics of a single counter over the runs of a region */
+typedef struct pspProfileMeasure
+{
+  u32_t uiMin;
+  u32_t uiMax;
+  u64_t udTotal;
+} pspProfileMeasure_t;
+
+/* Statistics of a region-id */
+typedef struct pspProfileStats
+{
+  u32_t               uiCount;                                     /* Number of measured runs */
+  pspProfileMeasure_t stCounter[D_PSP_PROFILE_NUM_OF_COUNTERS];
+} pspProfileStats_t;
+
+/* Region in progress */
+typedef struct pspProfileFrame
+{
+  u32_t uiId;
+  u32_t uiStart[D_PSP_PROFILE_NUM_OF_COUNTERS];
+} pspProfileFrame_t;
+
+/* Regions in progress of a hart */
+typedef struct pspProfileStack
+{
+  u32_t             uiDepth;                                       /* Number of regions in progress */
+  u32_t             uiNumOfSkipped;                                /* Regions deeper than D_PSP_PROFILE_MAX_DEPTH */
+  pspProfileFrame_t stFrame[D_PSP_PROFILE_MAX_DEPTH];
+} pspProfileStack_t;
+
+/**
+* local prototypes
+*/
+
+/**
+* external prototypes
+*/
+
+/**
+* global variables
+*/
+
+/**
+* APIs
+*/
+
+/**
+* @brief - Program the events of the four event counters, start the counters and clear
+*          the profiling statistics of the current hart
+*
+* @parameter - uiEvent0..3 - events (D_CYCLES_CLOCKS_ACTIVE etc.) of D_PSP_COUNTER0..3
+* @return    - none
+*/
+void pspProfileInit(u32_t uiEvent0, u32_t uiEvent1, u32_t uiEvent2, u32_t uiEvent3);
+
+/**
+* @brief - Clear the profiling statistics of the current hart
+*
+* @parameter - none
+* @return    - none
+*/
+void pspProfileReset(void);
+
+/**
+* @brief - Start a region. Use M_PSP_PROFILE_BEGIN so the call is compiled out
+*          without D_PSP_PROFILE
+*
+* @parameter - uiId - region-id, less than D_PSP_PROFILE_NUM_OF_IDS
+* @return    - none
+*/
+void pspProfileBegin(u32_t uiId);
+
+/**
+* @brief - End the innermost region and accumulate its counters. Use M_PSP_PROFILE_END
+*          so the call is compiled out without D_PSP_PROFILE
+*
+* @parameter - uiId - region-id. Must be the id of the innermost region
+* @return    - none
+*/
+void pspProfileEnd(u32_t uiId);
+
+/**
+* @brief - Get the profiling statistics of a region-id on the current hart
+*
+* @parameter - uiId   - region-id
+* @parameter - pStats - output - copy of the statistics
+* @return    - u32_t  - number of measured runs of the region
+*/
+u32_t pspProfileGetStats(u32_t uiId, pspProfileStats_t* pStats);
+
+#endif /* __PSP_PROFILE_EH1_H__ */
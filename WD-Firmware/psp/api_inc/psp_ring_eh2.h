@@ -0,0 +1,163 @@
+/*
+* SPDX-License-Identifier: Apache-2.0
+* Copyright 2026 Western Digital Corporation or its affiliates.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http:*www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+/**
+* @file   psp_ring_eh2.h
+* @author Western Digital
+* @date   16.10.2026
+* @brief  The file defines lock-free ring buffers for passing words between harts on
+*         SweRV EH2:
+*         - SPSC - single producer and single consumer
+*         - MPSC - multiple producers and a single consumer
+*         The rings and their buffers must reside in the DCCM (atomic commands)
+*/
+#ifndef  __PSP_RING_EH2_H__
+#define  __PSP_RING_EH2_H__
+
+/**
+* include files
+*/
+
+/**
+* definitions
+*/
+/* The producer index and the consumer index are kept in separate lines of this size,
+ * so the producer and the consumer do not write the same line */
+#ifndef D_PSP_RING_LINE_SIZE
+  #define D_PSP_RING_LINE_SIZE    64
+#endif
+
+#define D_PSP_RING_LINE_PAD_SIZE  (D_PSP_RING_LINE_SIZE - sizeof(u32_t))
+
+/**
+* types
+*/
+/* Single producer single consumer ring. The indices are free-running - the ring is
+ * empty when they are equal and full when they differ by the ring size */
+typedef struct pspRingSpsc
+{
+  volatile u32_t uiHead;                          /* Next index to write. Written by the producer only */
+  u08_t          ucHeadPad[D_PSP_RING_LINE_PAD_SIZE];
+  volatile u32_t uiTail;                          /* Next index to read. Written by the consumer only */
+  u08_t          ucTailPad[D_PSP_RING_LINE_PAD_SIZE];
+  u32_t*         pBuffer;                         /* Ring buffer. Read only after initialization */
+  u32_t          uiMask;                          /* Ring size - 1 */
+} D_PSP_ALIGNED(D_PSP_RING_LINE_SIZE) pspRingSpsc_t;
+
+/* Slot of a multiple producers ring. The sequence tells the slot state to the producers
+ * and to the consumer */
+typedef struct pspRingSlot
+{
+  volatile u32_t uiSequence;                      /* == index - free for the producer of that index.
+                                                     == index + 1 - holds the item of that index */
+  u32_t          uiItem;
+} pspRingSlot_t;
+
+/* Multiple producers single consumer ring. The producers reserve an index with an
+ * atomic compare-and-swap and publish the item through the slot sequence */
+typedef struct pspRingMpsc
+{
+  volatile u32_t uiHead;                          /* Next index to reserve. Updated by the producers atomically */
+  u08_t          ucHeadPad[D_PSP_RING_LINE_PAD_SIZE];
+  volatile u32_t uiTail;                          /* Next index to read. Written by the consumer only */
+  u08_t          ucTailPad[D_PSP_RING_LINE_PAD_SIZE];
+  pspRingSlot_t* pSlots;                          /* Ring slots. Read only after initialization */
+  u32_t          uiMask;                          /* Ring size - 1 */
+} D_PSP_ALIGNED(D_PSP_RING_LINE_SIZE) pspRingMpsc_t;
+
+/**
+* local prototypes
+*/
+
+/**
+* external prototypes
+*/
+
+/**
+* macros
+*/
+
+/**
+* global variables
+*/
+
+/**
+* APIs
+*/
+
+/**
+* @brief - Initialize a single producer single consumer ring
+*
+* @parameter - pRing    - the ring
+* @parameter - pBuffer  - buffer of the ring
+* @parameter - uiSize   - number of words in the buffer. Must be a power of 2
+*
+* @return    - none
+*/
+void pspRingSpscInit(pspRingSpsc_t* pRing, u32_t* pBuffer, u32_t uiSize);
+
+/**
+* @brief - Put a word in a single producer single consumer ring. Called by the producer only
+*
+* @parameter - pRing    - the ring
+* @parameter - uiItem   - word to put
+*
+* @return    - D_PSP_SUCCESS, D_PSP_FAIL - the ring is full
+*/
+u32_t pspRingSpscPush(pspRingSpsc_t* pRing, u32_t uiItem);
+
+/**
+* @brief - Take a word from a single producer single consumer ring. Called by the consumer only
+*
+* @parameter - pRing    - the ring
+* @parameter - pItem    - output - the word taken
+*
+* @return    - D_PSP_SUCCESS, D_PSP_FAIL - the ring is empty
+*/
+u32_t pspRingSpscPop(pspRingSpsc_t* pRing, u32_t* pItem);
+
+/**
+* @brief - Initialize a multiple producers single consumer ring
+*
+* @parameter - pRing    - the ring
+* @parameter - pSlots   - slots of the ring
+* @parameter - uiSize   - number of slots. Must be a power of 2
+*
+* @return    - none
+*/
+void pspRingMpscInit(pspRingMpsc_t* pRing, pspRingSlot_t* pSlots, u32_t uiSize);
+
+/**
+* @brief - Put a word in a multiple producers single consumer ring. Can be called by any hart
+*
+* @parameter - pRing    - the ring
+* @parameter - uiItem   - word to put
+*
+* @return    - D_PSP_SUCCESS, D_PSP_FAIL - the ring is full
+*/
+u32_t pspRingMpscPush(pspRingMpsc_t* pRing, u32_t uiItem);
+
+/**
+* @brief - Take a word from a multiple producers single consumer ring. Called by the consumer only
+*
+* @parameter - pRing    - the ring
+* @parameter - pItem    - output - the word taken
+*
+* @return    - D_PSP_SUCCESS, D_PSP_FAIL - the ring is empty
+*/
+u32_t pspRingMpscPop(pspRingMpsc_t* pRing, u32_t* pItem);
+
+#endif /* __PSP_RING_EH2_H__ */
@@ -0,0 +1,158 @@
+/*
+* SPDX-License-Identifier: Apache-2.0
+* Copyright 2026 Western Digital Corporation or its affiliates.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http:*www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+/**
+* @file   psp_timer_wheel_eh1.h
+* @author Western Digital
+* @date   16.10.2026
+* @brief  The file defines the high-resolution timer service of SweRV cores. One-shot and
+*         periodic timers are kept in a hierarchical timing wheel, indexed by their
+*         expiration time in mcycle, and an internal timer interrupts the hart at the next
+*         expiration. The callbacks are called in interrupt context. Start and stop take a
+*         constant time, regardless of the number of running timers
+*/
+#ifndef  __PSP_TIMER_WHEEL_EH1_H__
+#define  __PSP_TIMER_WHEEL_EH1_H__
+
+/**
+* include files
+*/
+
+/**
+* definitions
+*/
+/* Resolution of the wheel - 2^shift cycles. A timer expires on the first wheel tick at or
+   after its expiration cycle. 0 - a cycle */
+#ifndef D_PSP_TIMER_WHEEL_TICK_SHIFT
+  #define D_PSP_TIMER_WHEEL_TICK_SHIFT     4
+#endif
+
+/* Number of levels. Each level has 32 slots, so the levels cover 2^(5 * levels) ticks.
+   Later timers wait on an overflow list, that is sorted out once per this range */
+#ifndef D_PSP_TIMER_WHEEL_LEVELS
+  #define D_PSP_TIMER_WHEEL_LEVELS         4
+#endif
+
+#define D_PSP_TIMER_WHEEL_SLOT_BITS        5
+#define D_PSP_TIMER_WHEEL_SLOTS            (1 << D_PSP_TIMER_WHEEL_SLOT_BITS)
+/* List of a timer that is not running - so a zeroed timer is not running */
+#define D_PSP_TIMER_WHEEL_NOT_ACTIVE       0
+/* A list per slot of each level, and the overflow list after them */
+#define D_PSP_TIMER_WHEEL_FIRST_LIST       1
+#define D_PSP_TIMER_WHEEL_OVERFLOW_LIST    (D_PSP_TIMER_WHEEL_FIRST_LIST + D_PSP_TIMER_WHEEL_LEVELS * D_PSP_TIMER_WHEEL_SLOTS)
+#define D_PSP_TIMER_WHEEL_NUM_OF_LISTS     (D_PSP_TIMER_WHEEL_OVERFLOW_LIST + 1)
+
+#if (D_PSP_TIMER_WHEEL_LEVELS < 1) || (D_PSP_TIMER_WHEEL_LEVELS > 6)
+  #error "D_PSP_TIMER_WHEEL_LEVELS must be 1 to 6"
+#endif
+
+/**
+* types
+*/
+/* Called in interrupt context when the timer expires */
+typedef void (*fptrPspTimerWheelCallback_t)(void* pArg);
+
+/* A timer. Allocated by the caller and zeroed before its first use. Must not be changed
+   while it is running */
+typedef struct pspTimerWheelTimer
+{
+  struct pspTimerWheelTimer* pNext;
+  struct pspTimerWheelTimer* pPrev;
+  u64_t udExpiryCycles;                            /* mcycle value the timer expires at */
+  u32_t uiPeriodCycles;                            /* 0 - one-shot */
+  u32_t uiList;                                    /* List of the timer, or D_PSP_TIMER_WHEEL_NOT_ACTIVE */
+  fptrPspTimerWheelCallback_t fptrCallback;
+  void* pArg;
+} pspTimerWheelTimer_t;
+
+/* Timing wheel of a hart */
+typedef struct pspTimerWheel
+{
+  u64_t udTick;                                    /* Last wheel tick processed */
+  u64_t udArmedTick;                               /* Wheel tick the internal timer is set to */
+  u32_t uiTimer;                                   /* Internal timer of the wheel */
+  u32_t uiSlotsBitmap[D_PSP_TIMER_WHEEL_LEVELS];   /* Non-empty slots of each level */
+  pspTimerWheelTimer_t* pList[D_PSP_TIMER_WHEEL_NUM_OF_LISTS];
+} pspTimerWheel_t;
+
+/**
+* local prototypes
+*/
+
+/**
+* external prototypes
+*/
+
+/**
+* macros
+*/
+
+/**
+* global variables
+*/
+
+/**
+* APIs
+*/
+
+/**
+* @brief - Initialize the timing wheel of the current hart on an internal timer. The machine
+*          interrupts must be enabled by the caller
+*
+* @parameter - uiTimer - D_PSP_INTERNAL_TIMER0 or D_PSP_INTERNAL_TIMER1
+* @return    - none
+*/
+void pspTimerWheelInit(u32_t uiTimer);
+
+/**
+* @brief - Start a timer on the wheel of the current hart. A running timer is restarted
+*
+* @parameter - pTimer          - the timer
+* @parameter - uiTimeoutCycles - cycles from now to the first expiration
+* @parameter - uiPeriodCycles  - cycles between the next expirations. 0 - one-shot
+* @parameter - fptrCallback    - called in interrupt context on every expiration
+* @parameter - pArg            - argument of the callback
+* @return    - none
+*/
+void pspTimerWheelTimerStart(pspTimerWheelTimer_t* pTimer, u32_t uiTimeoutCycles, u32_t uiPeriodCycles,
+                             fptrPspTimerWheelCallback_t fptrCallback, void* pArg);
+
+/**
+* @brief - Stop a timer. Nothing is done if it is not running
+*
+* @parameter - pTimer - the timer
+* @return    - none
+*/
+void pspTimerWheelTimerStop(pspTimerWheelTimer_t* pTimer);
+
+/**
+* @brief - Check whether a timer is running
+*
+* @parameter - pTimer - the timer
+* @return    - D_PSP_TRUE if the timer is running, D_PSP_FALSE otherwise
+*/
+u32_t pspTimerWheelTimerIsActive(pspTimerWheelTimer_t* pTimer);
+
+/**
+* @brief - Expire the due timers and set the internal timer to the next expiration. Called
+*          from the internal timer interrupt
+*
+* @parameter - none
+* @return    - none
+*/
+void pspTimerWheelIsr(void);
+
+#endif /* __PSP_TIMER_WHEEL_EH1_H__ */
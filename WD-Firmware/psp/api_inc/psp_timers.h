@@ -83,4 +83,13 @@ u64_t pspMachineTimerCounterGet(void);
 */
 u64_t pspMachineTimerCompareCounterGet(void);
 
+/**
+* @brief Set Machine Timer compare counter to an absolute time
+*
+*
+* @param - udCompareCycles  - timer counter value to interrupt at
+*
+*/
+void pspMachineTimerCompareCounterSet(u64_t udCompareCycles);
+
 #endif /* __PSP_TIMERS_H__*/
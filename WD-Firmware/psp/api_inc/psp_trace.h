@@ -0,0 +1,137 @@
+/*
+* SPDX-License-Identifier: Apache-2.0
+* Copyright 2026 Western Digital Corporation or its affiliates.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http:*www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+/**
+* @file   psp_trace.h
+* @author Western Digital
+* @date   16.10.2026
+* @brief  The file defines the PSP interrupts and exceptions latency tracing API.
+*         Tracing is active only when the PSP is built with D_PSP_TRACE_INT
+*/
+#ifndef  __PSP_TRACE_H__
+#define  __PSP_TRACE_H__
+
+/**
+* include files
+*/
+
+/**
+* definitions
+*/
+/* Number of PIC sources that are traced separately. Higher source ids are counted in the last entry */
+#ifndef D_PSP_TRACE_INT_EXT_SOURCES
+  #define D_PSP_TRACE_INT_EXT_SOURCES    16
+#endif
+
+/* Number of bins in the log2 histograms */
+#ifndef D_PSP_TRACE_INT_HIST_BINS
+  #define D_PSP_TRACE_INT_HIST_BINS      12
+#endif
+
+/* Trace-ids: exceptions first, then core interrupts (by mcause) and then PIC sources */
+#define D_PSP_TRACE_INT_CORE_INT_FIRST_ID   D_PSP_NUM_EXC_CAUSE
+#define D_PSP_TRACE_INT_NUM_CORE_INTS       32
+#define D_PSP_TRACE_INT_EXT_SRC_FIRST_ID    (D_PSP_TRACE_INT_CORE_INT_FIRST_ID + D_PSP_TRACE_INT_NUM_CORE_INTS)
+#define D_PSP_TRACE_INT_NUM_IDS             (D_PSP_TRACE_INT_EXT_SRC_FIRST_ID + D_PSP_TRACE_INT_EXT_SOURCES)
+
+/**
+* macros
+*/
+/* Trace-id of an exception cause (E_EXC_XXX) */
+#define M_PSP_TRACE_INT_ID_EXCEPTION(uiExcpCause)   (uiExcpCause)
+/* Trace-id of a core interrupt cause (E_MACHINE_XXX_CAUSE) */
+#define M_PSP_TRACE_INT_ID_INTERRUPT(uiIntCause)    (D_PSP_TRACE_INT_CORE_INT_FIRST_ID + (uiIntCause))
+/* Trace-id of a PIC source (SweRV only - machine external interrupts are traced per PIC source) */
+#define M_PSP_TRACE_INT_ID_EXT_SOURCE(uiSourceId)   (D_PSP_TRACE_INT_EXT_SRC_FIRST_ID + (uiSourceId))
+
+/**
+* types
+*/
+/* Statistics of a single measured interval, in cycles */
+typedef struct pspTraceIntMeasure
+{
+  u32_t uiMin;
+  u32_t uiMax;
+  u32_t uiMean;    /* Calculated by pspTraceIntGetStats */
+  u64_t udSum;
+} pspTraceIntMeasure_t;
+
+/* Statistics of a trace-id. Histogram bin 0 counts intervals of 0 cycles and bin n counts
+ * intervals of [2^(n-1), 2^n) cycles. The last bin counts all the longer intervals */
+typedef struct pspTraceIntStats
+{
+  u32_t                uiCount;
+  pspTraceIntMeasure_t stLatency;     /* Vector entry to handler start */
+  pspTraceIntMeasure_t stHandler;     /* Handler start to handler end */
+  pspTraceIntMeasure_t stTotal;       /* Vector entry to trap exit stamp (context restore and mret not included) */
+  u32_t                uiLatencyHistogram[D_PSP_TRACE_INT_HIST_BINS];
+  u32_t                uiTotalHistogram[D_PSP_TRACE_INT_HIST_BINS];
+} pspTraceIntStats_t;
+
+/* Time stamps of the trap in progress - filled by the vector table */
+typedef struct pspTraceIntStamps
+{
+  u32_t uiEntry;
+  u32_t uiHandlerStart;
+  u32_t uiHandlerEnd;
+  u32_t uiReserved;
+} pspTraceIntStamps_t;
+
+/**
+* local prototypes
+*/
+
+/**
+* external prototypes
+*/
+
+/**
+* global variables
+*/
+
+/**
+* APIs
+*/
+
+/**
+* @brief - Clear the tracing statistics of the current hart. Must be called before
+*          interrupts are enabled, as the statistics are not initialized by the loader
+*
+* @parameter - none
+* @return    - none
+*/
+void pspTraceIntReset(void);
+
+/**
+* @brief - Get the tracing statistics of a trace-id on the current hart
+*
+* @parameter - uiTraceId - trace-id (M_PSP_TRACE_INT_ID_EXCEPTION/INTERRUPT/EXT_SOURCE)
+* @parameter - pStats    - output - copy of the statistics, including the mean values
+* @return    - u32_t     - number of traps traced for this trace-id
+*/
+u32_t pspTraceIntGetStats(u32_t uiTraceId, pspTraceIntStats_t* pStats);
+
+/**
+* @brief - Update the statistics with the trap in progress. Called from the vector
+*          table (M_PSP_TRACE_INT_EXIT) just before the interrupted context is restored.
+*          The trap exit stamp is taken here
+*
+* @parameter - none
+* @return    - none
+*/
+void pspTraceIntUpdate(void);
+
+#endif /* __PSP_TRACE_H__ */
@@ -34,6 +34,8 @@
 /**
 * definitions
 */
+#define D_PSP_ATOMICS_LOCKED    1  /* locking value of the spin-locks */
+#define D_PSP_ATOMICS_UNLOCKED  0
 
 /**
 * local prototypes
@@ -47,6 +49,11 @@
 /**
 * macros
 */
+/* AMOs with explicit ordering - the spin-locks below are written in C */
+#define M_PSP_ATOMICS_AMO_SWAP_AQ(uiPrev, pAddress, uiValue) \
+  __asm__ volatile ("amoswap.w.aq %0, %2, %1" : "=r" (uiPrev), "+A" (*(pAddress)) : "r" (uiValue) : "memory")
+#define M_PSP_ATOMICS_AMO_SWAP_AQRL(uiPrev, pAddress, uiValue) \
+  __asm__ volatile ("amoswap.w.aqrl %0, %2, %1" : "=r" (uiPrev), "+A" (*(pAddress)) : "r" (uiValue) : "memory")
 
 /**
 * global variables
@@ -69,206 +76,329 @@ D_PSP_NO_INLINE D_PSP_TEXT_SECTION u32_t pspAtomicsCompareAndSet(u32_t* pAddress
 {
   M_PSP_ASSERT(NULL != pAddress);
 
-  __asm__(
-     "lr.w.aq    t0, (a0);"           /* Load original value from memory (address given by a0) to t0 */
-     "bne        t0, a1, skip_out;"   /* If the value there is not as expected - return non-zero (== failure) */
-     "sc.w.rl    a0, a2, (a0);"       /* Otherwise update memory with value from a2. If update succeeds - a0 = 0, otherwise - non-zero */
-  "skip_out:"
-  );
-  return (u32_t)(pAddress);
+  return pspAtomicsInlineCompareAndSet(pAddress, uiExpectedValue, uiDesiredValue);
 }
 
 /**
-* @brief - spin-lock on a parameter in a given memory address
+* @brief - spin for a given number of iterations. Used as backoff by the spin-locks
 *
-* @parameter - (a0) address in the memory with the parameter to check
+* @parameter - number of spin-loop iterations
+*/
+D_PSP_TEXT_SECTION void pspAtomicsBackoff(u32_t uiIterations)
+{
+  while (0 != uiIterations)
+  {
+    __asm__ volatile ("nop");
+    uiIterations--;
+  }
+}
+
+/**
+* @brief - spin-lock on a parameter in a given memory address.
+*          While the lock is taken, wait with bounded exponential backoff
+*
+* @parameter - address in the memory with the parameter to check
 */
 D_PSP_NO_INLINE D_PSP_TEXT_SECTION void pspAtomicsEnterCriticalSection(u32_t* pAddress)
 {
+  u32_t uiPrevValue;
+  u32_t uiBackoff = D_PSP_ATOMICS_BACKOFF_MIN;
+
   M_PSP_ASSERT(NULL != pAddress);
 
-  __asm__(
-     "li           t0, 1;"         /* '1' is the locking value */
-  "spin:"
-     "amoswap.w.aq t0, t0, (a0);"  /* set '1' in the given address and set the previous value in t0 (atomic command) */
-     "bnez         t0, spin;"      /* spin until t0=0 --> meaning the lock was free and now we locked it  */
-     "ret;"                        /* lock is done */
-    );
+  while (1)
+  {
+    /* set '1' in the given address and get the previous value (atomic command) */
+    M_PSP_ATOMICS_AMO_SWAP_AQ(uiPrevValue, pAddress, D_PSP_ATOMICS_LOCKED);
+    if (0 == uiPrevValue)
+    {
+      /* the lock was free and now we locked it */
+      break;
+    }
+
+    /* The lock is taken - wait with plain loads until it looks free, so the lock word is not hammered with AMOs */
+    do
+    {
+      pspAtomicsBackoff(uiBackoff);
+      if (D_PSP_ATOMICS_BACKOFF_MAX > uiBackoff)
+      {
+        uiBackoff <<= 1;
+      }
+    } while (0 != *(volatile u32_t*)pAddress);
+  }
 }
 
 /**
 * @brief - release the lock by parameter in a given memory address using atomic command
 *
-* @parameter - (a0) address in the memory with the parameter to set
+* @parameter - address in the memory with the parameter to set
 */
 D_PSP_NO_INLINE D_PSP_TEXT_SECTION void pspAtomicsExitCriticalSection(u32_t* pAddress)
 {
   M_PSP_ASSERT(NULL != pAddress);
 
-  __asm__(
-     "amoswap.w.rl x0, x0, (a0);"  /* clear the lock */
-     "ret;"
-  );
+  /* clear the lock */
+  __asm__ volatile ("amoswap.w.rl x0, x0, %0" : "+A" (*pAddress) : : "memory");
+}
+
+/**
+* @brief - ticket spin-lock on a parameter in a given memory address. The lock is granted
+*          in FIFO order. While waiting, backoff in proportion to the number of waiters ahead
+*
+* @parameter - address in the memory of the ticket lock word (0 == unlocked)
+*/
+D_PSP_NO_INLINE D_PSP_TEXT_SECTION void pspAtomicsEnterCriticalSectionTicket(u32_t* pAddress)
+{
+  u32_t uiTicket;
+  u32_t uiWaitersAhead;
+  u32_t uiBackoff;
+
+  M_PSP_ASSERT(NULL != pAddress);
+
+  /* Take a ticket - increment 'next ticket' and get the previous value (atomic command) */
+  uiTicket = pspAtomicsInlineAmoAdd(pAddress, D_PSP_ATOMICS_TICKET_NEXT_INC);
+  uiTicket >>= D_PSP_ATOMICS_TICKET_NEXT_SHIFT;
+
+  /* Wait for 'now serving' to reach the ticket */
+  uiWaitersAhead = (uiTicket - *(volatile u32_t*)pAddress) & D_PSP_ATOMICS_TICKET_SERVING_MASK;
+  while (0 != uiWaitersAhead)
+  {
+    uiBackoff = uiWaitersAhead * D_PSP_ATOMICS_TICKET_BACKOFF;
+    pspAtomicsBackoff((D_PSP_ATOMICS_BACKOFF_MAX < uiBackoff) ? D_PSP_ATOMICS_BACKOFF_MAX : uiBackoff);
+    uiWaitersAhead = (uiTicket - *(volatile u32_t*)pAddress) & D_PSP_ATOMICS_TICKET_SERVING_MASK;
+  }
+
+  /* Acquire - the critical section is not accessed before the lock is taken */
+  M_PSP_ATOMICS_FENCE_ACQUIRE();
+}
+
+/**
+* @brief - release a ticket lock - hand it over to the next ticket
+*
+* @parameter - address in the memory of the ticket lock word
+*/
+D_PSP_NO_INLINE D_PSP_TEXT_SECTION void pspAtomicsExitCriticalSectionTicket(u32_t* pAddress)
+{
+  volatile u16_t* pServing = (volatile u16_t*)pAddress;
+
+  M_PSP_ASSERT(NULL != pAddress);
+
+  /* Release - the critical section is completed before the lock is handed over */
+  M_PSP_ATOMICS_FENCE_RELEASE();
+
+  /* Only the lock owner writes 'now serving' (low half-word), so a plain store is enough.
+   * The waiters update only 'next ticket' with AMOs, which do not overlap this store */
+  *pServing = (u16_t)(*pServing + 1);
+}
+
+/**
+* @brief - queue (MCS-style) spin-lock. The harts wait in FIFO order, each hart spins on
+*          its own flag and the lock owner hands the lock over to its successor. The queue
+*          nodes are indexed by hart id, so a hart can wait only once on a given lock
+*
+* @parameter - address in the memory of the queue tail (hart id + 1 of the last hart in the queue, 0 == unlocked)
+* @parameter - the successor of each hart in the queue (hart id + 1, 0 == none) - array of D_PSP_NUM_OF_HARTS
+* @parameter - the wait flag of each hart in the queue - array of D_PSP_NUM_OF_HARTS
+*/
+D_PSP_NO_INLINE D_PSP_TEXT_SECTION void pspAtomicsEnterCriticalSectionQueue(u32_t* pAddress, u32_t* pQueueNext, u32_t* pQueueWait)
+{
+  u32_t uiHartId = M_PSP_MACHINE_GET_HART_ID();
+  u32_t uiPrevTail;
+  u32_t uiBackoff = D_PSP_ATOMICS_BACKOFF_MIN;
+
+  M_PSP_ASSERT((NULL != pAddress) && (NULL != pQueueNext) && (NULL != pQueueWait));
+
+  pQueueNext[uiHartId] = 0;
+  pQueueWait[uiHartId] = D_PSP_ATOMICS_LOCKED;
+
+  /* Join the queue - the node is initialized before it is published (atomic command) */
+  M_PSP_ATOMICS_AMO_SWAP_AQRL(uiPrevTail, pAddress, uiHartId + 1);
+
+  if (0 != uiPrevTail)
+  {
+    /* Link behind the predecessor and spin on the own flag until the lock is handed over */
+    ((volatile u32_t*)pQueueNext)[uiPrevTail - 1] = uiHartId + 1;
+    while (D_PSP_ATOMICS_LOCKED == ((volatile u32_t*)pQueueWait)[uiHartId])
+    {
+      pspAtomicsBackoff(uiBackoff);
+      if (D_PSP_ATOMICS_BACKOFF_MAX > uiBackoff)
+      {
+        uiBackoff <<= 1;
+      }
+    }
+
+    /* Acquire - the critical section is not accessed before the lock is taken */
+    M_PSP_ATOMICS_FENCE_ACQUIRE();
+  }
+}
+
+/**
+* @brief - release a queue (MCS-style) spin-lock - hand it over to the successor, if any
+*
+* @parameter - address in the memory of the queue tail
+* @parameter - the successor of each hart in the queue - array of D_PSP_NUM_OF_HARTS
+* @parameter - the wait flag of each hart in the queue - array of D_PSP_NUM_OF_HARTS
+*/
+D_PSP_NO_INLINE D_PSP_TEXT_SECTION void pspAtomicsExitCriticalSectionQueue(u32_t* pAddress, u32_t* pQueueNext, u32_t* pQueueWait)
+{
+  u32_t uiHartId = M_PSP_MACHINE_GET_HART_ID();
+  u32_t uiNext, uiPrevTail;
+
+  M_PSP_ASSERT((NULL != pAddress) && (NULL != pQueueNext) && (NULL != pQueueWait));
+
+  uiNext = ((volatile u32_t*)pQueueNext)[uiHartId];
+  if (0 == uiNext)
+  {
+    /* No successor is known - if this hart is still the tail, the queue becomes empty */
+    uiPrevTail = pspAtomicsInlineCompareAndSwap(pAddress, uiHartId + 1, 0);
+    if ((uiHartId + 1) == uiPrevTail)
+    {
+      return;
+    }
+
+    /* A hart has joined the queue but did not link itself yet - wait for it */
+    do
+    {
+      uiNext = ((volatile u32_t*)pQueueNext)[uiHartId];
+    } while (0 == uiNext);
+  }
+
+  /* Release - the critical section is completed before the lock is handed over */
+  M_PSP_ATOMICS_FENCE_RELEASE();
+  ((volatile u32_t*)pQueueWait)[uiNext - 1] = D_PSP_ATOMICS_UNLOCKED;
 }
 
 /**
 * @brief - AMO (Atomic Memory Operation) Swap command
 *
-* @parameter - (a0) address in the memory with the parameter to check and add
-* @parameter - (a1) value to load to that address
+* @parameter - address in the memory with the parameter to check and add
+* @parameter - value to load to that address
 *
-* @return    - (a0) previous value in the address
+* @return    - previous value in the address
 */
 D_PSP_TEXT_SECTION u32_t pspAtomicsAmoSwap(u32_t* pAddress, u32_t uiValueToSwap)
 {
   M_PSP_ASSERT(NULL != pAddress);
 
-  __asm__(
-     "amoswap.w a0, a1, (a0);"   /* put the value in a1 in the given address in a0 and set the previous content of that address in a0 (atomic command) */
-  );
-  return ((u32_t)pAddress);         /* return the previous value in the given address (pAddress = a0) */
+  return pspAtomicsInlineAmoSwap(pAddress, uiValueToSwap);
 }
 
 /**
 * @brief - AMO (Atomic Memory Operation) Add command
 *
-* @parameter - (a0) address in the memory with the parameter to check and add
-* @parameter - (a1) value to add
+* @parameter - address in the memory with the parameter to check and add
+* @parameter - value to add
 *
-* @return    - (a0) previous value in the address
+* @return    - previous value in the address
 */
 D_PSP_TEXT_SECTION u32_t pspAtomicsAmoAdd(u32_t* pAddress, u32_t uiValueToAdd)
 {
   M_PSP_ASSERT(NULL != pAddress);
 
-  __asm__(
-     "amoadd.w a0, a1, (a0);"   /* add the value in a1 to the given address in a0 and set the previous content of that address in a0 (atomic command) */
-  );
-  return ((u32_t)pAddress);        /* return the previous value in the given address (pAddress = a0) */
+  return pspAtomicsInlineAmoAdd(pAddress, uiValueToAdd);
 }
 
 /**
 * @brief - AMO (Atomic Memory Operation) bitwise AND command
 *
-* @parameter - (a0) address in the memory with the parameter to check and do bitwise-AND with
-* @parameter - (a1) value to do bitwise-AND with the content of the given memory
+* @parameter - address in the memory with the parameter to check and do bitwise-AND with
+* @parameter - value to do bitwise-AND with the content of the given memory
 *
-* @return    - (a0) previous value in the address
+* @return    - previous value in the address
 */
 D_PSP_TEXT_SECTION u32_t pspAtomicsAmoAnd(u32_t* pAddress, u32_t uiValueToAndWith)
 {
   M_PSP_ASSERT(NULL != pAddress);
 
-  __asm__(
-     "amoand.w a0, a1, (a0);"   /* Do bitwise-AND with the value in a1 and the content given address in a0 and set the previous content of that address in a0 (atomic command) */
-  );
-  return ((u32_t)pAddress);        /* return the previous value in the given address (pAddress = a0) */
+  return pspAtomicsInlineAmoAnd(pAddress, uiValueToAndWith);
 }
 
 /**
 * @brief - AMO (Atomic Memory Operation) bitwise OR command
 *
-* @parameter - (a0) address in the memory with the parameter to check and do bitwise-OR with
-* @parameter - (a1) value to do bitwise-OR with the content of the given memory
+* @parameter - address in the memory with the parameter to check and do bitwise-OR with
+* @parameter - value to do bitwise-OR with the content of the given memory
 *
-* @return    - (a0) previous value in the address
+* @return    - previous value in the address
 */
 D_PSP_TEXT_SECTION u32_t pspAtomicsAmoOr(u32_t* pAddress, u32_t uiValueToOrWith)
 {
   M_PSP_ASSERT(NULL != pAddress);
 
-  __asm__(
-     "amoor.w a0, a1, (a0);"   /* Do bitwise-OR with the value in a1 and the content given address in a0 and set the previous content of that address in a0 (atomic command) */
-  );
-  return ((u32_t)pAddress);       /* return the previous value in the given address (pAddress = a0) */
+  return pspAtomicsInlineAmoOr(pAddress, uiValueToOrWith);
 }
 
 /**
 * @brief - AMO (Atomic Memory Operation) bitwise XOR command
 *
-* @parameter - (a0) address in the memory with the parameter to check and do bitwise-XOR with
-* @parameter - (a1) value to do bitwise-XOR with the content of the given memory
+* @parameter - address in the memory with the parameter to check and do bitwise-XOR with
+* @parameter - value to do bitwise-XOR with the content of the given memory
 *
-* @return    - (a0) previous value in the address
+* @return    - previous value in the address
 */
 D_PSP_TEXT_SECTION u32_t pspAtomicsAmoXor(u32_t* pAddress, u32_t uiValueToXorWith)
 {
   M_PSP_ASSERT(NULL != pAddress);
 
-  __asm__(
-     "amoxor.w a0, a1, (a0);"   /* Do bitwise-XOR with the value in a1 and the content given address in a0 and set the previous content of that address in a0 (atomic command) */
-  );
-  return ((u32_t)pAddress);        /* return the previous value in the given address (pAddress = a0) */
+  return pspAtomicsInlineAmoXor(pAddress, uiValueToXorWith);
 }
 
 /**
 * @brief - AMO (Atomic Memory Operation) min command
 *
-* @parameter - (a0) address in the memory with the parameter to compare
-* @parameter - (a1) value to compare with the content of the given memory, to determine the minimum
+* @parameter - address in the memory with the parameter to compare
+* @parameter - value to compare with the content of the given memory, to determine the minimum
 *
-* @return    - (a0) previous value in the address
+* @return    - previous value in the address
 */
 D_PSP_TEXT_SECTION u32_t pspAtomicsAmoMin(u32_t* pAddress, u32_t uiValueToCompare)
 {
   M_PSP_ASSERT(NULL != pAddress);
 
-  __asm__(
-     "amomin.w a0, a1, (a0);"   /* Compare contents of memory in a0 with the value in a1 and take the minimum of them. Set the previous content of the address in a0 (atomic command) */
-  );
-  return ((u32_t)pAddress);        /* return the previous value in the given address (pAddress = a0) */
+  return pspAtomicsInlineAmoMin(pAddress, uiValueToCompare);
 }
 
 /**
 * @brief - AMO (Atomic Memory Operation) max command
 *
-* @parameter - (a0) address in the memory with the parameter to compare
-* @parameter - (a1) value to compare with the content of the given memory, to determine the maximum
+* @parameter - address in the memory with the parameter to compare
+* @parameter - value to compare with the content of the given memory, to determine the maximum
 *
-* @return    - (a0) previous value in the address
+* @return    - previous value in the address
 */
 D_PSP_TEXT_SECTION u32_t pspAtomicsAmoMax(u32_t* pAddress, u32_t uiValueToCompare)
 {
   M_PSP_ASSERT(NULL != pAddress);
 
-  __asm__(
-     "amomax.w a0, a1, (a0);"   /* Compare contents of memory in a0 with the value in a1 and take the maximum of them. Set the previous content of the address in a0 (atomic command) */
-  );
-  return ((u32_t)pAddress);        /* return the previous value in the given address (pAddress = a0) */
+  return pspAtomicsInlineAmoMax(pAddress, uiValueToCompare);
 }
 
 /**
 * @brief - AMO (Atomic Memory Operation) min command - unsigned
 *
-* @parameter - (a0) address in the memory with the parameter to compare (unsigned)
-* @parameter - (a1) unsigned value to compare with the content of the given memory, to determine the minimum
+* @parameter - address in the memory with the parameter to compare (unsigned)
+* @parameter - unsigned value to compare with the content of the given memory, to determine the minimum
 *
-* @return    - (a0) previous value in the address
+* @return    - previous value in the address
 */
 D_PSP_TEXT_SECTION u32_t pspAtomicsAmoMinUnsigned(u32_t* pAddress, u32_t uiValueToCompare)
 {
   M_PSP_ASSERT(NULL != pAddress);
 
-  __asm__(
-     "amominu.w a0, a1, (a0);"   /* Unsigned-compare contents of memory in a0 with the value in a1 and take the minimum of them. Set the previous content of the address in a0 (atomic command) */
-  );
-  return ((u32_t)pAddress);         /* return the previous value in the given address (pAddress = a0) */
+  return pspAtomicsInlineAmoMinUnsigned(pAddress, uiValueToCompare);
 }
 
 /**
 * @brief - AMO (Atomic Memory Operation) max command - unsigned
 *
-* @parameter - (a0) address in the memory with the parameter to compare (unsigned)
-* @parameter - (a1) unsigned value to compare with the content of the given memory, to determine the maximum
+* @parameter - address in the memory with the parameter to compare (unsigned)
+* @parameter - unsigned value to compare with the content of the given memory, to determine the maximum
 *
-* @return    - (a0) previous value in the address
+* @return    - previous value in the address
 */
 D_PSP_TEXT_SECTION u32_t pspAtomicsAmoMaxUnsigned(u32_t* pAddress, u32_t uiValueToCompare)
 {
   M_PSP_ASSERT(NULL != pAddress);
 
-  __asm__(
-     "amomaxu.w a0, a1, (a0);"   /* Unsigned-compare contents of memory in a0 with the value in a1 and take the maximum of them. Set the previous content of the address in a0 (atomic command) */
-  );
-  return ((u32_t)pAddress);         /* return the previous value in the given address (pAddress = a0) */
+  return pspAtomicsInlineAmoMaxUnsigned(pAddress, uiValueToCompare);
 }
@@ -0,0 +1,161 @@
+/*
+* SPDX-License-Identifier: Apache-2.0
+* Copyright 2026 Western Digital Corporation or its affiliates.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http:*www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+/**
+* @file   psp_barrier_eh2.c
+* @author Western Digital
+* @date   16.10.2026
+* @brief  The file supplies the hart barrier and the parallel-for of SweRV EH2.
+*         Each hart flips its own sense and counts itself in with an atomic add.
+*         The last hart to arrive resets the count and then publishes its sense;
+*         the other harts spin on the shared sense until it matches theirs
+*/
+
+/**
+* include files
+*/
+#include "psp_api.h"
+
+/**
+* types
+*/
+
+/**
+* definitions
+*/
+
+/**
+* local prototypes
+*/
+
+/**
+* external prototypes
+*/
+
+/**
+* macros
+*/
+
+/**
+* global variables
+*/
+
+/**
+* APIs
+*/
+
+/**
+* @brief - Initialize a barrier. Must be done before any hart waits on it
+*
+* @parameter - pBarrier     - the barrier
+* @parameter - uiNumOfHarts - number of harts that wait on the barrier
+*
+* @return    - none
+*/
+D_PSP_TEXT_SECTION void pspBarrierInit(pspBarrier_t* pBarrier, u32_t uiNumOfHarts)
+{
+  u32_t uiHart;
+
+  M_PSP_ASSERT((NULL != pBarrier) && (0 != uiNumOfHarts) && (D_PSP_NUM_OF_HARTS >= uiNumOfHarts));
+
+  pBarrier->uiNumOfArrived = 0;
+  pBarrier->uiSense        = 0;
+  pBarrier->uiNumOfHarts   = uiNumOfHarts;
+  for (uiHart = 0; uiHart < D_PSP_NUM_OF_HARTS; uiHart++)
+  {
+    pBarrier->uiHartSense[uiHart] = 0;
+  }
+}
+
+/**
+* @brief - Wait until all the harts of the group arrive at the barrier
+*
+* @parameter - pBarrier - the barrier
+*
+* @return    - none
+*/
+D_PSP_TEXT_SECTION void pspBarrierWait(pspBarrier_t* pBarrier)
+{
+  u32_t uiHartId = M_PSP_MACHINE_GET_HART_ID();
+  u32_t uiSense;
+
+  M_PSP_ASSERT(NULL != pBarrier);
+
+  /* Each round waits for the opposite sense of the previous one */
+  uiSense = pBarrier->uiHartSense[uiHartId] ^ 1;
+  pBarrier->uiHartSense[uiHartId] = uiSense;
+
+  /* Release - the work before the barrier is visible to the harts that leave it */
+  M_PSP_ATOMICS_FENCE_RELEASE();
+
+  if ((pBarrier->uiNumOfHarts - 1) == pspAtomicsInlineAmoAdd((u32_t*)&pBarrier->uiNumOfArrived, 1))
+  {
+    /* Last to arrive - reset the count for the next round before releasing the others */
+    pBarrier->uiNumOfArrived = 0;
+    M_PSP_ATOMICS_FENCE_RELEASE();
+    pBarrier->uiSense = uiSense;
+  }
+  else
+  {
+    while (uiSense != pBarrier->uiSense)
+    {
+      /* wait for the last hart to flip the sense */
+    }
+  }
+
+  /* Acquire - the work after the barrier does not start before all the harts arrived */
+  M_PSP_ATOMICS_FENCE_ACQUIRE();
+}
+
+/**
+* @brief - Split the index range uiFirst..uiEnd-1 into one contiguous chunk per hart of the
+*          core, run the body on the chunk of the current hart and wait for the other harts
+*          to finish theirs. Must be called by all the harts of the core with the same arguments
+*
+* @parameter - pBarrier - barrier of all the harts of the core
+* @parameter - uiFirst  - first index
+* @parameter - uiEnd    - index that follows the last index
+* @parameter - fptrBody - body to run on the chunk of the current hart
+* @parameter - pArg     - argument to pass to the body
+*
+* @return    - none
+*/
+D_PSP_TEXT_SECTION void pspParallelFor(pspBarrier_t* pBarrier, u32_t uiFirst, u32_t uiEnd, fptrPspParallelForBody_t fptrBody, void* pArg)
+{
+  u32_t uiNumOfHarts = M_PSP_MACHINE_GET_NUM_OF_HARTS();
+  u32_t uiHartId = M_PSP_MACHINE_GET_HART_ID();
+  u32_t uiChunkSize, uiChunkFirst, uiChunkEnd;
+
+  M_PSP_ASSERT((NULL != pBarrier) && (NULL != fptrBody) && (uiFirst <= uiEnd) &&
+               (uiNumOfHarts == pBarrier->uiNumOfHarts));
+
+  /* Round the chunk up, so the last hart gets the smallest chunk */
+  uiChunkSize  = (uiEnd - uiFirst + uiNumOfHarts - 1) / uiNumOfHarts;
+  uiChunkFirst = uiFirst + uiHartId * uiChunkSize;
+  uiChunkEnd   = uiChunkFirst + uiChunkSize;
+  if (uiChunkEnd > uiEnd)
+  {
+    uiChunkEnd = uiEnd;
+  }
+
+  if (uiChunkFirst < uiChunkEnd)
+  {
+    fptrBody(uiChunkFirst, uiChunkEnd, pArg);
+  }
+
+  /* Join */
+  pspBarrierWait(pBarrier);
+}
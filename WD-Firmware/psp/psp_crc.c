@@ -0,0 +1,278 @@
+/*
+* SPDX-License-Identifier: Apache-2.0
+* Copyright 2026 Western Digital Corporation or its affiliates.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http:*www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+/**
+* @file   psp_crc.c
+* @author Western Digital
+* @date   16.10.2026
+* @brief  The file supplies the PSP CRC32 and CRC32C APIs.
+*         The bytes up to the first word boundary and after the last one are processed
+*         one by one, and the words between them a word per step. Both steps multiply
+*         the pending bits by x^32 modulo the polynomial:
+*         - clmul engine: Barrett reduction - two carry-less multiplications by the
+*           constants mu = x^64 / P and P
+*         - table engine: slice-by-4 - a table per byte position of the word
+*/
+
+/**
+* include files
+*/
+#include "psp_api.h"
+
+/**
+* types
+*/
+
+/**
+* definitions
+*/
+#define D_PSP_CRC_WORD_MASK            (sizeof(u32_t) - 1)
+#define D_PSP_CRC_BYTE_MASK            0xFF
+#define D_PSP_CRC_NUM_OF_SLICES        4
+#define D_PSP_CRC_TABLE_SIZE           256
+#define D_PSP_CRC32C_POLY_REFLECTED    0x82F63B78   /* D_PSP_CRC32C_POLY bit-reversed */
+
+#ifdef D_PSP_CRC_USE_CLMUL
+  /* Barrett constants - the lower 32 bits of floor(x^64 / P) (bit-reversed for the reflected CRC32C) */
+  #define D_PSP_CRC32_MU               0x04D101DF
+  #define D_PSP_CRC32C_MU_REFLECTED    0x6F5389F8
+#endif /* D_PSP_CRC_USE_CLMUL */
+
+/**
+* local prototypes
+*/
+
+/**
+* external prototypes
+*/
+
+/**
+* macros
+*/
+#define M_PSP_CRC_IS_ALIGNED(pAddress)  (0 == ((u32_t)(pAddress) & D_PSP_CRC_WORD_MASK))
+
+/**
+* global variables
+*/
+#ifndef D_PSP_CRC_USE_CLMUL
+/* Slice-by-4 tables. Table n holds the CRC of a byte followed by n zero bytes */
+D_PSP_DATA_SECTION u32_t g_uiPspCrc32Table[D_PSP_CRC_NUM_OF_SLICES][D_PSP_CRC_TABLE_SIZE];
+D_PSP_DATA_SECTION u32_t g_uiPspCrc32cTable[D_PSP_CRC_NUM_OF_SLICES][D_PSP_CRC_TABLE_SIZE];
+#endif /* D_PSP_CRC_USE_CLMUL */
+
+/**
+* APIs
+*/
+
+#ifdef D_PSP_CRC_USE_CLMUL
+/**
+* @brief - CRC32 step: multiply the pending bits by x^32 modulo the polynomial
+*
+* @parameter - pending bits (degree < 32)
+*
+* @return - the pending bits * x^32 mod P
+*/
+D_PSP_ALWAYS_INLINE u32_t pspCrc32Reduce(u32_t uiValue)
+{
+  u32_t uiQuotient;
+
+  /* quotient = floor(value * x^32 / P) = floor(value * mu / x^32). mu has an x^32 term */
+  uiQuotient = pspBitmanipClmulh(uiValue, D_PSP_CRC32_MU) ^ uiValue;
+
+  /* remainder = value * x^32 - quotient * P. Only the lower 32 bits are left */
+  return pspBitmanipClmul(uiQuotient, D_PSP_CRC32_POLY);
+}
+
+/**
+* @brief - CRC32C step (reflected): multiply the pending bits by x^32 modulo the polynomial
+*
+* @parameter - pending bits, bit-reversed
+*
+* @return - the pending bits * x^32 mod P, bit-reversed
+*/
+D_PSP_ALWAYS_INLINE u32_t pspCrc32cReduce(u32_t uiValue)
+{
+  u32_t uiQuotient;
+
+  /* The reduction of pspCrc32Reduce on bit-reversed operands */
+  uiQuotient = (pspBitmanipClmul(uiValue, D_PSP_CRC32C_MU_REFLECTED) << 1) ^ uiValue;
+
+  return pspBitmanipClmulr(uiQuotient, D_PSP_CRC32C_POLY_REFLECTED);
+}
+#endif /* D_PSP_CRC_USE_CLMUL */
+
+/**
+* @brief - Initialize the CRC engine. Builds the slice-by-4 tables when the table engine
+*          is used. Must be called before the CRC APIs are used
+*
+* @return - none
+*/
+D_PSP_TEXT_SECTION void pspCrcInit(void)
+{
+#ifndef D_PSP_CRC_USE_CLMUL
+  u32_t uiIndex, uiBit, uiSlice, uiCrc, uiCrcC;
+
+  for (uiIndex = 0; uiIndex < D_PSP_CRC_TABLE_SIZE; uiIndex++)
+  {
+    uiCrc  = uiIndex << 24;
+    uiCrcC = uiIndex;
+    for (uiBit = 0; uiBit < 8; uiBit++)
+    {
+      uiCrc  = (uiCrc & 0x80000000) ? ((uiCrc << 1) ^ D_PSP_CRC32_POLY) : (uiCrc << 1);
+      uiCrcC = (uiCrcC & 1) ? ((uiCrcC >> 1) ^ D_PSP_CRC32C_POLY_REFLECTED) : (uiCrcC >> 1);
+    }
+    g_uiPspCrc32Table[0][uiIndex]  = uiCrc;
+    g_uiPspCrc32cTable[0][uiIndex] = uiCrcC;
+  }
+
+  for (uiSlice = 1; uiSlice < D_PSP_CRC_NUM_OF_SLICES; uiSlice++)
+  {
+    for (uiIndex = 0; uiIndex < D_PSP_CRC_TABLE_SIZE; uiIndex++)
+    {
+      uiCrc  = g_uiPspCrc32Table[uiSlice - 1][uiIndex];
+      uiCrcC = g_uiPspCrc32cTable[uiSlice - 1][uiIndex];
+      g_uiPspCrc32Table[uiSlice][uiIndex]  = (uiCrc << 8) ^ g_uiPspCrc32Table[0][uiCrc >> 24];
+      g_uiPspCrc32cTable[uiSlice][uiIndex] = (uiCrcC >> 8) ^ g_uiPspCrc32cTable[0][uiCrcC & D_PSP_CRC_BYTE_MASK];
+    }
+  }
+#endif /* D_PSP_CRC_USE_CLMUL */
+}
+
+/**
+* @brief - Calculate the CRC32 of a buffer - polynomial 0x04C11DB7, not reflected, no final xor
+*
+* @parameter - pBuffer       - the buffer
+* @parameter - uiSizeInBytes - size of the buffer
+* @parameter - uiInit        - initial value, typically D_PSP_CRC_INIT
+*
+* @return - the CRC
+*/
+D_PSP_TEXT_SECTION u32_t pspCrc32(const void* pBuffer, u32_t uiSizeInBytes, u32_t uiInit)
+{
+  const u08_t* pByte = (const u08_t*)pBuffer;
+  const u32_t* pWord;
+  u32_t        uiCrc = uiInit, uiValue;
+
+  M_PSP_ASSERT((NULL != pBuffer) || (0 == uiSizeInBytes));
+
+  /* Head - up to the first word boundary */
+  while ((0 != uiSizeInBytes) && !M_PSP_CRC_IS_ALIGNED(pByte))
+  {
+    uiValue = (uiCrc >> 24) ^ *pByte++;
+#ifdef D_PSP_CRC_USE_CLMUL
+    uiCrc = (uiCrc << 8) ^ pspCrc32Reduce(uiValue);
+#else
+    uiCrc = (uiCrc << 8) ^ g_uiPspCrc32Table[0][uiValue];
+#endif /* D_PSP_CRC_USE_CLMUL */
+    uiSizeInBytes--;
+  }
+
+  /* Body - a word per step */
+  pWord = (const u32_t*)pByte;
+  while (sizeof(u32_t) <= uiSizeInBytes)
+  {
+    /* The first byte in the memory is the most significant */
+    uiValue = pspBitmanipRev8(*pWord) ^ uiCrc;
+#ifdef D_PSP_CRC_USE_CLMUL
+    uiCrc = pspCrc32Reduce(uiValue);
+#else
+    uiCrc = g_uiPspCrc32Table[3][uiValue >> 24] ^
+            g_uiPspCrc32Table[2][(uiValue >> 16) & D_PSP_CRC_BYTE_MASK] ^
+            g_uiPspCrc32Table[1][(uiValue >> 8) & D_PSP_CRC_BYTE_MASK] ^
+            g_uiPspCrc32Table[0][uiValue & D_PSP_CRC_BYTE_MASK];
+#endif /* D_PSP_CRC_USE_CLMUL */
+    pWord++;
+    uiSizeInBytes -= sizeof(u32_t);
+  }
+
+  /* Tail */
+  pByte = (const u08_t*)pWord;
+  while (0 != uiSizeInBytes)
+  {
+    uiValue = (uiCrc >> 24) ^ *pByte++;
+#ifdef D_PSP_CRC_USE_CLMUL
+    uiCrc = (uiCrc << 8) ^ pspCrc32Reduce(uiValue);
+#else
+    uiCrc = (uiCrc << 8) ^ g_uiPspCrc32Table[0][uiValue];
+#endif /* D_PSP_CRC_USE_CLMUL */
+    uiSizeInBytes--;
+  }
+
+  return uiCrc;
+}
+
+/**
+* @brief - Calculate the CRC32C (Castagnoli) of a buffer - polynomial 0x1EDC6F41, reflected,
+*          no final xor
+*
+* @parameter - pBuffer       - the buffer
+* @parameter - uiSizeInBytes - size of the buffer
+* @parameter - uiInit        - initial value, typically D_PSP_CRC_INIT
+*
+* @return - the CRC
+*/
+D_PSP_TEXT_SECTION u32_t pspCrc32c(const void* pBuffer, u32_t uiSizeInBytes, u32_t uiInit)
+{
+  const u08_t* pByte = (const u08_t*)pBuffer;
+  const u32_t* pWord;
+  u32_t        uiCrc = uiInit, uiValue;
+
+  M_PSP_ASSERT((NULL != pBuffer) || (0 == uiSizeInBytes));
+
+  /* Head - up to the first word boundary */
+  while ((0 != uiSizeInBytes) && !M_PSP_CRC_IS_ALIGNED(pByte))
+  {
+    uiValue = (uiCrc ^ *pByte++) & D_PSP_CRC_BYTE_MASK;
+#ifdef D_PSP_CRC_USE_CLMUL
+    uiCrc = (uiCrc >> 8) ^ pspCrc32cReduce(uiValue << 24);
+#else
+    uiCrc = (uiCrc >> 8) ^ g_uiPspCrc32cTable[0][uiValue];
+#endif /* D_PSP_CRC_USE_CLMUL */
+    uiSizeInBytes--;
+  }
+
+  /* Body - a word per step. The first byte in the memory is the least significant */
+  pWord = (const u32_t*)pByte;
+  while (sizeof(u32_t) <= uiSizeInBytes)
+  {
+    uiValue = uiCrc ^ *pWord;
+#ifdef D_PSP_CRC_USE_CLMUL
+    uiCrc = pspCrc32cReduce(uiValue);
+#else
+    uiCrc = g_uiPspCrc32cTable[3][uiValue & D_PSP_CRC_BYTE_MASK] ^
+            g_uiPspCrc32cTable[2][(uiValue >> 8) & D_PSP_CRC_BYTE_MASK] ^
+            g_uiPspCrc32cTable[1][(uiValue >> 16) & D_PSP_CRC_BYTE_MASK] ^
+            g_uiPspCrc32cTable[0][uiValue >> 24];
+#endif /* D_PSP_CRC_USE_CLMUL */
+    pWord++;
+    uiSizeInBytes -= sizeof(u32_t);
+  }
+
+  /* Tail */
+  pByte = (const u08_t*)pWord;
+  while (0 != uiSizeInBytes)
+  {
+    uiValue = (uiCrc ^ *pByte++) & D_PSP_CRC_BYTE_MASK;
+#ifdef D_PSP_CRC_USE_CLMUL
+    uiCrc = (uiCrc >> 8) ^ pspCrc32cReduce(uiValue << 24);
+#else
+    uiCrc = (uiCrc >> 8) ^ g_uiPspCrc32cTable[0][uiValue];
+#endif /* D_PSP_CRC_USE_CLMUL */
+    uiSizeInBytes--;
+  }
+
+  return uiCrc;
+}
@@ -54,6 +54,10 @@
     #define D_PSP_EXT_INTERRUPT_LAST_SOURCE_USED     D_EXT_INTERRUPT_LAST_SOURCE_USED
 #endif
 
+/* The threshold saved by pspMachineExtInterruptsDisableToThreshold is kept in bits 12..15
+ * of the state - these bits are not used in mie of the SweRV cores */
+#define D_PSP_EXT_INT_THRESHOLD_STATE_SHIFT    12
+
 /**
 * macros
 */
@@ -314,6 +318,42 @@ D_PSP_TEXT_SECTION void pspMachineExtInterruptsSetNestingPriorityThreshold(u32_t
   pspMachineInterruptsRestore(uiInterruptsState);
 }
 
+/*
+* This function masks the core interrupts and the external interrupts up to the given priority
+* threshold, leaving the external interrupts of a higher priority unmasked. mstatus.MIE is not
+* changed, so it can be used for critical sections that must not delay hard real-time sources
+*
+* @param uiThreshold = priority threshold to be programmed to PIC
+* @param pOutPrevIntState = previous state of the threshold and the core interrupts
+* @return None
+*/
+D_PSP_TEXT_SECTION void pspMachineExtInterruptsDisableToThreshold(u32_t uiThreshold, u32_t *pOutPrevIntState)
+{
+  u32_t uiPrevCoreInts, uiPrevThreshold;
+
+  /* Assert on threshold value */
+  M_PSP_ASSERT(uiThreshold <= D_PSP_EXT_INT_THRESHOLD_15);
+
+  /* Each step is a single CSR access, so no interrupts disabling is needed */
+  M_PSP_READ_AND_CLEAR_CSR(uiPrevCoreInts, D_PSP_MIE_NUM, D_PSP_EXT_INT_THRESHOLD_CORE_INTS_MASK);
+  M_PSP_SWAP_CSR(uiPrevThreshold, D_PSP_MEIPT_NUM, uiThreshold);
+
+  *pOutPrevIntState = (uiPrevCoreInts & D_PSP_EXT_INT_THRESHOLD_CORE_INTS_MASK) |
+                      ((uiPrevThreshold & D_PSP_MEIPT_PRITHRESH_MASK) << D_PSP_EXT_INT_THRESHOLD_STATE_SHIFT);
+}
+
+/*
+* This function restores the state saved by pspMachineExtInterruptsDisableToThreshold
+*
+* @param uiPrevIntState = previous state of the threshold and the core interrupts
+* @return None
+*/
+D_PSP_TEXT_SECTION void pspMachineExtInterruptsRestoreThreshold(u32_t uiPrevIntState)
+{
+  M_PSP_WRITE_CSR(D_PSP_MEIPT_NUM, (uiPrevIntState >> D_PSP_EXT_INT_THRESHOLD_STATE_SHIFT) & D_PSP_MEIPT_PRITHRESH_MASK);
+  M_PSP_SET_CSR(D_PSP_MIE_NUM, uiPrevIntState & D_PSP_EXT_INT_THRESHOLD_CORE_INTS_MASK);
+}
+
 /*
 * brief - This function checks whether a given external interrupt is pending or not
 *
@@ -328,10 +368,10 @@ D_PSP_TEXT_SECTION u32_t pspMachineExtInterruptIsPending(u32_t uiExtInterrupt)
   uiRegister = D_PSP_MEIP_ADDR + D_PSP_REG32_BYTE_WIDTH * (uiExtInterrupt >> D_PSP_SHIFT_5);
 
   /* Calculate the bit in meipX register to access to check the input interrupt number */
-  uiBit = uiExtInterrupt - (uiRegister * D_PSP_REG32_BIT_WIDTH);
+  uiBit = uiExtInterrupt & (D_PSP_REG32_BIT_WIDTH - 1);
 
   /* Check the specific bit */
-  uiResult = !!( M_PSP_READ_REGISTER_32(uiRegister) & (1 << uiBit) );
+  uiResult = pspBitmanipBitExtract(M_PSP_READ_REGISTER_32(uiRegister), uiBit);
 
   return (uiResult);
 }
@@ -501,6 +541,9 @@ D_PSP_TEXT_SECTION void pspMachineExtInterruptIsr(void)
 {
   fptrFunction_t fptrExtIntHandler = NULL;
   u32_t* pClaimId;
+#ifdef D_PSP_NESTED_EXT_INT
+  u32_t uiMepc, uiMstatus, uiMie, uiCurrentPriorityLevel;
+#endif /* D_PSP_NESTED_EXT_INT */
 
   /* Trigger capture of the interrupt source ID(handler address), write '1' to meicpct */
   M_PSP_WRITE_CSR(D_PSP_MEICPCT_NUM, D_PSP_MEICPCT_CAPTURE_MASK);
@@ -512,7 +555,29 @@ D_PSP_TEXT_SECTION void pspMachineExtInterruptIsr(void)
 
   M_PSP_ASSERT(fptrExtIntHandler != NULL);
 
+#ifdef D_PSP_NESTED_EXT_INT
+  /* Save the trap state that a preempting interrupt overrides */
+  uiMepc = M_PSP_READ_CSR(D_PSP_MEPC_NUM);
+  uiMstatus = M_PSP_READ_CSR(D_PSP_MSTATUS_NUM);
+  uiCurrentPriorityLevel = M_PSP_READ_CSR(D_PSP_MEICURPL_NUM);
+
+  /* Raise the current priority level to the one of the claimed source, so only higher
+   * priority sources can preempt the handler. Core interrupts stay masked meanwhile */
+  M_PSP_WRITE_CSR(D_PSP_MEICURPL_NUM, M_PSP_READ_CSR(D_PSP_MEICIDPL_NUM));
+  M_PSP_READ_AND_CLEAR_CSR(uiMie, D_PSP_MIE_NUM, ~D_PSP_MIE_MEIE_MASK);
+  M_PSP_SET_CSR(D_PSP_MSTATUS_NUM, D_PSP_MSTATUS_MIE_MASK);
+
+  fptrExtIntHandler();
+
+  /* Restore the state of the trap before it is returned from */
+  M_PSP_CLEAR_CSR(D_PSP_MSTATUS_NUM, D_PSP_MSTATUS_MIE_MASK);
+  M_PSP_SET_CSR(D_PSP_MIE_NUM, uiMie);
+  M_PSP_WRITE_CSR(D_PSP_MEICURPL_NUM, uiCurrentPriorityLevel);
+  M_PSP_WRITE_CSR(D_PSP_MSTATUS_NUM, uiMstatus);
+  M_PSP_WRITE_CSR(D_PSP_MEPC_NUM, uiMepc);
+#else
   fptrExtIntHandler();
+#endif /* D_PSP_NESTED_EXT_INT */
 }
 
 /**
@@ -560,10 +625,10 @@ D_PSP_TEXT_SECTION u32_t pspMachineExtInterruptIsPendingOnHart(u32_t uiExtInterr
   uiRegister = D_PSP_MEITP_ADDR + D_PSP_REG32_BYTE_WIDTH * (uiExtInterruptNumber >> D_PSP_SHIFT_5);
 
   /* Calculate the bit in meitpX register to access to check the input interrupt number */
-  uiBit = uiExtInterruptNumber - (uiRegister * D_PSP_REG32_BIT_WIDTH);
+  uiBit = uiExtInterruptNumber & (D_PSP_REG32_BIT_WIDTH - 1);
 
   /* Check the specific bit */
-  uiResult = !!( M_PSP_READ_REGISTER_32(uiRegister) & (1 << uiBit) );
+  uiResult = pspBitmanipBitExtract(M_PSP_READ_REGISTER_32(uiRegister), uiBit);
 
   return (uiResult);
 }
@@ -19,7 +19,7 @@
 * @author Nati Rapaport
 * @date   05.07.2020
 * @brief  The file defines mutexs for internal PSP usage. It is relevant for SweRV EH2 (multi HW-threads core)
-*         
+*         The internal mutexs are ticket locks, so the harts get them in FIFO order
 */
 
 /**
@@ -80,7 +80,7 @@ void pspInternalMutexLock(u32_t uiMutexNumber)
 {
   M_PSP_ASSERT(D_PSP_NUM_OF_INTERNAL_MUTEXES > uiMutexNumber);
 
-  pspAtomicsEnterCriticalSection((u32_t*)&g_uiInternalPspMutex[uiMutexNumber]);
+  pspAtomicsEnterCriticalSectionTicket((u32_t*)&g_uiInternalPspMutex[uiMutexNumber]);
 }
 
 /**
@@ -93,5 +93,5 @@ void pspInternalMutexUnlock(u32_t uiMutexNumber)
 {
   M_PSP_ASSERT(D_PSP_NUM_OF_INTERNAL_MUTEXES > uiMutexNumber);
 
-  pspAtomicsExitCriticalSection((u32_t*)&g_uiInternalPspMutex[uiMutexNumber]);
+  pspAtomicsExitCriticalSectionTicket((u32_t*)&g_uiInternalPspMutex[uiMutexNumber]);
 }
@@ -394,3 +394,57 @@ D_PSP_TEXT_SECTION void pspUserInterruptsEnableIntNumber(u32_t uiInterruptNumber
 
   M_PSP_SET_CSR(D_PSP_UIE_NUM, M_PSP_BIT_MASK(uiInterruptNumber));
 }
+
+#ifdef D_PSP_STATIC_ISR
+/* Default ISRs called directly from the vector table when D_PSP_STATIC_ISR is defined.
+ * They are weak so an application can bind its own ISR at link time; otherwise they
+ * call the handler registered by pspMachineInterruptsRegisterIsr */
+
+/**
+* @brief - Default ISR of the exceptions
+*
+* @param none
+*
+* @return none
+*/
+D_PSP_WEAK D_PSP_TEXT_SECTION void pspMachineInterruptsExceptionIsr(void)
+{
+  g_fptrIntExceptionIntHandler();
+}
+
+/**
+* @brief - Default ISR of the machine software interrupt
+*
+* @param none
+*
+* @return none
+*/
+D_PSP_WEAK D_PSP_TEXT_SECTION void pspMachineInterruptsMSoftIsr(void)
+{
+  g_fptrIntMSoftIntHandler();
+}
+
+/**
+* @brief - Default ISR of the machine timer interrupt
+*
+* @param none
+*
+* @return none
+*/
+D_PSP_WEAK D_PSP_TEXT_SECTION void pspMachineInterruptsMTimerIsr(void)
+{
+  g_fptrIntMTimerIntHandler();
+}
+
+/**
+* @brief - Default ISR of the machine external interrupt
+*
+* @param none
+*
+* @return none
+*/
+D_PSP_WEAK D_PSP_TEXT_SECTION void pspMachineInterruptsMExternIsr(void)
+{
+  g_fptrIntMExternIntHandler();
+}
+#endif /* D_PSP_STATIC_ISR */
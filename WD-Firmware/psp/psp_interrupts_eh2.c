@@ -64,6 +64,14 @@ D_PSP_TEXT_SECTION void pspMachineInterruptsDefaultHandler(void);
   /* ISR Stack for HART (HW thread) 1 */
   static /*D_PSP_DATA_SECTION*/ D_PSP_ALIGNED(16) pspStack_t udISRStackHart1[ D_ISR_STACK_SIZE ] ;
   const pspStack_t xISRStackTopHart1 = ( pspStack_t ) &( udISRStackHart1[ ( D_ISR_STACK_SIZE ) - 1 ] );
+
+  /* ISR Stack per HART - used by the vector table through mhartid */
+  const pspStack_t xISRStackTopPerHart[D_PSP_NUM_OF_HARTS] = {
+                       ( pspStack_t ) &( udISRStackHart0[ ( D_ISR_STACK_SIZE ) - 1 ] )
+#if D_PSP_NUM_OF_HARTS == 2
+                      ,( pspStack_t ) &( udISRStackHart1[ ( D_ISR_STACK_SIZE ) - 1 ] )
+#endif
+                       };
 #endif
 
 /* Exception handlers */
@@ -125,8 +133,9 @@ D_PSP_DATA_SECTION fptrPspInterruptHandler_t  g_fptrExceptions_ints[D_PSP_NUM_OF
                        pspMachineInterruptsDefaultHandler }};
 #endif
 
-/* Exceptions handler pointer */
-D_PSP_DATA_SECTION fptrPspInterruptHandler_t g_fptrIntExceptionIntHandler   = pspMachineInterruptsExcpHandlingSelector;
+/* Handler pointers - indexed by hart (HW thread). The vector table calls the handler of the current hart */
+/* Exceptions handler pointer */                                                                   /* Hart0 */                                /* Hart1 */
+D_PSP_DATA_SECTION fptrPspInterruptHandler_t g_fptrIntExceptionIntHandler[D_PSP_NUM_OF_HARTS]   = {pspMachineInterruptsExcpHandlingSelector, pspMachineInterruptsExcpHandlingSelector};
 
 /* Interrupts handler pointers */                                                                  /* Hart0 */                          /* Hart1 */
 D_PSP_DATA_SECTION fptrPspInterruptHandler_t g_fptrIntUSoftIntHandler[D_PSP_NUM_OF_HARTS]       = {pspMachineInterruptsDefaultHandler, pspMachineInterruptsDefaultHandler};
@@ -475,3 +484,81 @@ D_PSP_TEXT_SECTION void pspUserInterruptsEnableIntNumber(u32_t uiInterruptNumber
 
   M_PSP_SET_CSR(D_PSP_UIE_NUM, M_PSP_BIT_MASK(uiInterruptNumber));
 }
+
+#ifdef D_PSP_STATIC_ISR
+/* Default ISRs called directly from the vector table when D_PSP_STATIC_ISR is defined.
+ * They are weak so an application can bind its own ISR at link time; otherwise they
+ * call the handler registered by pspMachineInterruptsRegisterIsr */
+
+/**
+* @brief - Default ISR of the exceptions
+*
+* @param none
+*
+* @return none
+*/
+D_PSP_WEAK D_PSP_TEXT_SECTION void pspMachineInterruptsExceptionIsr(void)
+{
+  g_fptrIntExceptionIntHandler[M_PSP_MACHINE_GET_HART_ID()]();
+}
+
+/**
+* @brief - Default ISR of the machine software interrupt
+*
+* @param none
+*
+* @return none
+*/
+D_PSP_WEAK D_PSP_TEXT_SECTION void pspMachineInterruptsMSoftIsr(void)
+{
+  g_fptrIntMSoftIntHandler[M_PSP_MACHINE_GET_HART_ID()]();
+}
+
+/**
+* @brief - Default ISR of the machine timer interrupt
+*
+* @param none
+*
+* @return none
+*/
+D_PSP_WEAK D_PSP_TEXT_SECTION void pspMachineInterruptsMTimerIsr(void)
+{
+  g_fptrIntMTimerIntHandler[M_PSP_MACHINE_GET_HART_ID()]();
+}
+
+/**
+* @brief - Default ISR of the machine external interrupt
+*
+* @param none
+*
+* @return none
+*/
+D_PSP_WEAK D_PSP_TEXT_SECTION void pspMachineInterruptsMExternIsr(void)
+{
+  g_fptrIntMExternIntHandler[M_PSP_MACHINE_GET_HART_ID()]();
+}
+
+/**
+* @brief - Default ISR of the internal timer 0 interrupt
+*
+* @param none
+*
+* @return none
+*/
+D_PSP_WEAK D_PSP_TEXT_SECTION void pspMachineInterruptsMTimer0Isr(void)
+{
+  g_fptrIntMTimer0IntHandler[M_PSP_MACHINE_GET_HART_ID()]();
+}
+
+/**
+* @brief - Default ISR of the internal timer 1 interrupt
+*
+* @param none
+*
+* @return none
+*/
+D_PSP_WEAK D_PSP_TEXT_SECTION void pspMachineInterruptsMTimer1Isr(void)
+{
+  g_fptrIntMTimer1IntHandler[M_PSP_MACHINE_GET_HART_ID()]();
+}
+#endif /* D_PSP_STATIC_ISR */
@@ -438,3 +438,80 @@ D_PSP_TEXT_SECTION fptrPspInterruptHandler_t pspInterruptsGetExceptionHandler(u3
   return g_fptrExceptions_ints[uiExceptionCause];
 }
 
+#ifdef D_PSP_STATIC_ISR
+/* Default ISRs called directly from the vector table when D_PSP_STATIC_ISR is defined.
+ * They are weak so an application can bind its own ISR at link time; otherwise they
+ * call the handler registered by pspMachineInterruptsRegisterIsr */
+
+/**
+* @brief - Default ISR of the exceptions
+*
+* @param none
+*
+* @return none
+*/
+D_PSP_WEAK D_PSP_TEXT_SECTION void pspMachineInterruptsExceptionIsr(void)
+{
+  g_fptrIntExceptionIntHandler();
+}
+
+/**
+* @brief - Default ISR of the machine software interrupt
+*
+* @param none
+*
+* @return none
+*/
+D_PSP_WEAK D_PSP_TEXT_SECTION void pspMachineInterruptsMSoftIsr(void)
+{
+  g_fptrIntMSoftIntHandler();
+}
+
+/**
+* @brief - Default ISR of the machine timer interrupt
+*
+* @param none
+*
+* @return none
+*/
+D_PSP_WEAK D_PSP_TEXT_SECTION void pspMachineInterruptsMTimerIsr(void)
+{
+  g_fptrIntMTimerIntHandler();
+}
+
+/**
+* @brief - Default ISR of the machine external interrupt
+*
+* @param none
+*
+* @return none
+*/
+D_PSP_WEAK D_PSP_TEXT_SECTION void pspMachineInterruptsMExternIsr(void)
+{
+  g_fptrIntMExternIntHandler();
+}
+
+/**
+* @brief - Default ISR of the internal timer 0 interrupt
+*
+* @param none
+*
+* @return none
+*/
+D_PSP_WEAK D_PSP_TEXT_SECTION void pspMachineInterruptsMTimer0Isr(void)
+{
+  g_fptrIntMTimer0IntHandler();
+}
+
+/**
+* @brief - Default ISR of the internal timer 1 interrupt
+*
+* @param none
+*
+* @return none
+*/
+D_PSP_WEAK D_PSP_TEXT_SECTION void pspMachineInterruptsMTimer1Isr(void)
+{
+  g_fptrIntMTimer1IntHandler();
+}
+#endif /* D_PSP_STATIC_ISR */
@@ -0,0 +1,208 @@
+/*
+* SPDX-License-Identifier: Apache-2.0
+* Copyright 2026 Western Digital Corporation or its affiliates.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http:*www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+/**
+* @file   psp_ipi_eh2.c
+* @author Western Digital
+* @date   16.10.2026
+* @brief  The file supplies the inter-hart messaging (IPI) service of SweRV EH2.
+*         The sender posts to the MPSC ring of the target mailbox and then swaps the
+*         doorbell; only the sender that finds it idle raises the software interrupt.
+*         The target ISR sets the doorbell idle before it drains the ring, so a message
+*         posted after the drain always raises a new interrupt
+*/
+
+/**
+* include files
+*/
+#include "psp_api.h"
+
+/**
+* types
+*/
+
+/**
+* definitions
+*/
+
+/**
+* local prototypes
+*/
+D_PSP_TEXT_SECTION void pspIpiIsr(void);
+
+/**
+* external prototypes
+*/
+
+/**
+* macros
+*/
+
+/**
+* global variables
+*/
+D_PSP_DATA_SECTION pspIpiMailbox_t g_stPspIpiMailbox[D_PSP_NUM_OF_HARTS];
+
+/**
+* APIs
+*/
+
+/**
+* @brief - Ring the doorbell of a hart. The software interrupt is raised only if the
+*          doorbell is idle - posts to a rung doorbell are coalesced
+*
+* @parameter - uiTargetHart - hart to ring
+*
+* @return    - none
+*/
+D_PSP_ALWAYS_INLINE void pspIpiRingDoorbell(u32_t uiTargetHart)
+{
+  /* Release - the posted messages are visible before the doorbell is rung */
+  M_PSP_ATOMICS_FENCE_RELEASE();
+  if (D_PSP_IPI_DOORBELL_IDLE == pspAtomicsInlineAmoSwap(&g_stPspIpiMailbox[uiTargetHart].uiDoorbell, D_PSP_IPI_DOORBELL_RUNG))
+  {
+    M_PSP_IPI_MSIP_REG(uiTargetHart) = 1;
+  }
+}
+
+/**
+* @brief - Machine software interrupt handler - handle all the messages in the mailbox
+*          of the current hart
+*
+* @parameter - none
+*
+* @return    - none
+*/
+D_PSP_TEXT_SECTION void pspIpiIsr(void)
+{
+  u32_t uiHartId = M_PSP_MACHINE_GET_HART_ID();
+  pspIpiMailbox_t* pMailbox = &g_stPspIpiMailbox[uiHartId];
+  u32_t uiMessage;
+
+  /* Clear the interrupt and set the doorbell idle before draining - a post that
+   * follows the drain rings the doorbell again */
+  M_PSP_IPI_MSIP_REG(uiHartId) = 0;
+  /* The clear of msip is a device write - the AMO does not order it, so a sender could
+   * see the doorbell idle and raise msip before the clear lands */
+  M_PSP_INST_FENCE();
+  pspAtomicsInlineAmoSwap(&pMailbox->uiDoorbell, D_PSP_IPI_DOORBELL_IDLE);
+  /* Acquire - the mailbox is not read before the doorbell is set idle */
+  M_PSP_ATOMICS_FENCE_ACQUIRE();
+  pMailbox->uiNumOfInterrupts++;
+
+  while (D_PSP_SUCCESS == pspRingMpscPop(&pMailbox->stRing, &uiMessage))
+  {
+    pMailbox->uiNumOfMessages++;
+    pMailbox->fptrHandler(uiMessage);
+  }
+}
+
+/**
+* @brief - Initialize the mailbox of the current hart and enable its machine software
+*          interrupt. Must be called by each receiving hart before other harts post to it.
+*          The machine software interrupt is used by the IPI service only
+*
+* @parameter - fptrHandler - handler of the received messages. Called in interrupt context
+*
+* @return    - none
+*/
+D_PSP_TEXT_SECTION void pspIpiInit(fptrPspIpiHandler_t fptrHandler)
+{
+  u32_t uiHartId = M_PSP_MACHINE_GET_HART_ID();
+  pspIpiMailbox_t* pMailbox = &g_stPspIpiMailbox[uiHartId];
+
+  M_PSP_ASSERT(NULL != fptrHandler);
+
+  pspRingMpscInit(&pMailbox->stRing, pMailbox->stSlots, D_PSP_IPI_MAILBOX_SIZE);
+  pMailbox->fptrHandler       = fptrHandler;
+  pMailbox->uiNumOfInterrupts = 0;
+  pMailbox->uiNumOfMessages   = 0;
+  pMailbox->uiDoorbell        = D_PSP_IPI_DOORBELL_IDLE;
+  M_PSP_IPI_MSIP_REG(uiHartId) = 0;
+
+  pspMachineInterruptsRegisterIsr(pspIpiIsr, E_MACHINE_SOFTWARE_CAUSE);
+  pspMachineInterruptsEnableIntNumber(D_PSP_INTERRUPTS_MACHINE_SW);
+}
+
+/**
+* @brief - Post a message to the mailbox of a hart and ring its doorbell
+*
+* @parameter - uiTargetHart - hart to post to
+* @parameter - uiMessage    - the message
+*
+* @return    - D_PSP_SUCCESS, D_PSP_FAIL - the mailbox is full
+*/
+D_PSP_TEXT_SECTION u32_t pspIpiPost(u32_t uiTargetHart, u32_t uiMessage)
+{
+  u32_t uiRes;
+
+  M_PSP_ASSERT(D_PSP_NUM_OF_HARTS > uiTargetHart);
+
+  uiRes = pspRingMpscPush(&g_stPspIpiMailbox[uiTargetHart].stRing, uiMessage);
+  if (D_PSP_SUCCESS == uiRes)
+  {
+    pspIpiRingDoorbell(uiTargetHart);
+  }
+
+  return uiRes;
+}
+
+/**
+* @brief - Post a batch of messages to the mailbox of a hart and ring its doorbell once
+*
+* @parameter - uiTargetHart    - hart to post to
+* @parameter - pMessages       - the messages
+* @parameter - uiNumOfMessages - number of messages
+*
+* @return    - number of messages posted. Less than uiNumOfMessages when the mailbox is full
+*/
+D_PSP_TEXT_SECTION u32_t pspIpiPostBatch(u32_t uiTargetHart, const u32_t* pMessages, u32_t uiNumOfMessages)
+{
+  u32_t uiPosted = 0;
+
+  M_PSP_ASSERT((D_PSP_NUM_OF_HARTS > uiTargetHart) && (NULL != pMessages));
+
+  while ((uiPosted < uiNumOfMessages) &&
+         (D_PSP_SUCCESS == pspRingMpscPush(&g_stPspIpiMailbox[uiTargetHart].stRing, pMessages[uiPosted])))
+  {
+    uiPosted++;
+  }
+
+  if (0 != uiPosted)
+  {
+    pspIpiRingDoorbell(uiTargetHart);
+  }
+
+  return uiPosted;
+}
+
+/**
+* @brief - Get the statistics of the mailbox of the current hart
+*
+* @parameter - pNumOfInterrupts - output - number of IPI interrupts taken
+* @parameter - pNumOfMessages   - output - number of messages handled
+*
+* @return    - none
+*/
+D_PSP_TEXT_SECTION void pspIpiGetStats(u32_t* pNumOfInterrupts, u32_t* pNumOfMessages)
+{
+  pspIpiMailbox_t* pMailbox = &g_stPspIpiMailbox[M_PSP_MACHINE_GET_HART_ID()];
+
+  M_PSP_ASSERT((NULL != pNumOfInterrupts) && (NULL != pNumOfMessages));
+
+  *pNumOfInterrupts = pMailbox->uiNumOfInterrupts;
+  *pNumOfMessages   = pMailbox->uiNumOfMessages;
+}
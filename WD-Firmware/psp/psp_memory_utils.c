@@ -34,6 +34,14 @@
 /**
 * definitions
 */
+#define D_PSP_MEMORY_WORD_SIZE     sizeof(u32_t)
+#define D_PSP_MEMORY_WORD_MASK     (D_PSP_MEMORY_WORD_SIZE - 1)
+#define D_PSP_MEMORY_WORD_BITS     32
+#define D_PSP_MEMORY_UNROLL_WORDS  4   /* Words handled per iteration of the unrolled loops */
+#define D_PSP_MEMORY_UNROLL_SIZE   (D_PSP_MEMORY_UNROLL_WORDS * D_PSP_MEMORY_WORD_SIZE)
+#define D_PSP_MEMORY_BYTE_ONES     0x01010101  /* 0x01 in each byte of a word */
+#define D_PSP_MEMORY_BYTE_HIGHS    0x80808080  /* 0x80 in each byte of a word */
+#define D_PSP_MEMORY_ALL_BYTES_SET 0xFFFFFFFF
 
 /**
 * local prototypes
@@ -46,6 +54,8 @@
 /**
 * macros
 */
+#define M_PSP_MEMORY_IS_ALIGNED(pAddress)                 (0 == ((u32_t)(pAddress) & D_PSP_MEMORY_WORD_MASK))
+#define M_PSP_MEMORY_IS_CO_ALIGNED(pAddress1, pAddress2)  (0 == (((u32_t)(pAddress1) ^ (u32_t)(pAddress2)) & D_PSP_MEMORY_WORD_MASK))
 
 /**
 * global variables
@@ -55,6 +65,24 @@
 * APIs
 */
 
+/**
+* @brief - Check whether a word has a zero byte. With the bit-manipulation extension orc.b
+*          sets each non-zero byte to 0xFF, otherwise use the borrow of subtracting 1 from
+*          each byte
+*
+* @parameter - the word
+*
+* @return - non-zero if the word has a zero byte
+*/
+D_PSP_ALWAYS_INLINE u32_t pspMemoryHasZeroByte(u32_t uiWord)
+{
+#ifdef D_PSP_BITMANIP_HAS_ZBB
+  return (D_PSP_MEMORY_ALL_BYTES_SET != pspBitmanipOrcB(uiWord));
+#else
+  return ((uiWord - D_PSP_MEMORY_BYTE_ONES) & ~uiWord & D_PSP_MEMORY_BYTE_HIGHS);
+#endif
+}
+
 /**
 * @brief - PSP implementation of memset function - bytes setting
 * 
@@ -66,17 +94,319 @@
 */
 D_PSP_TEXT_SECTION void* pspMemsetBytes(void* pMemory, s08_t siVal, u32_t uiSizeInBytes)
 {
-   u32_t uiIndex;
-
    M_PSP_ASSERT(NULL != pMemory);
 
-   /* Loop on the memory and set it according the inputs */
-   for (uiIndex = 0 ; uiIndex < uiSizeInBytes ; uiIndex++)
-   {
-      *(u08_t*)(pMemory + uiIndex) = siVal;
-   }
+   return pspMemset(pMemory, (u08_t)siVal, uiSizeInBytes);
+}
+
+/**
+* @brief - PSP implementation of memset function. The bytes up to the first word boundary
+*          and after the last one are set one by one, and the words between them are set
+*          in an unrolled loop
+*
+* @parameter - address of the memory to be set
+* @parameter - value to set (the lower byte is used)
+* @parameter - number of bytes to set
+*
+* @return - address of the memory that has been set
+*/
+D_PSP_TEXT_SECTION void* pspMemset(void* pMemory, u32_t uiVal, u32_t uiSizeInBytes)
+{
+  u08_t* pByte = (u08_t*)pMemory;
+  u32_t* pWord;
+  u32_t  uiPattern;
+
+  M_PSP_ASSERT(NULL != pMemory);
+
+  uiVal &= 0xFF;
+  uiPattern = uiVal * D_PSP_MEMORY_BYTE_ONES;
+
+  /* Head - up to the first word boundary */
+  while ((0 != uiSizeInBytes) && !M_PSP_MEMORY_IS_ALIGNED(pByte))
+  {
+    *pByte++ = uiVal;
+    uiSizeInBytes--;
+  }
+
+  /* Body - whole words */
+  pWord = (u32_t*)pByte;
+  while (D_PSP_MEMORY_UNROLL_SIZE <= uiSizeInBytes)
+  {
+    pWord[0] = uiPattern;
+    pWord[1] = uiPattern;
+    pWord[2] = uiPattern;
+    pWord[3] = uiPattern;
+    pWord += D_PSP_MEMORY_UNROLL_WORDS;
+    uiSizeInBytes -= D_PSP_MEMORY_UNROLL_SIZE;
+  }
+  while (D_PSP_MEMORY_WORD_SIZE <= uiSizeInBytes)
+  {
+    *pWord++ = uiPattern;
+    uiSizeInBytes -= D_PSP_MEMORY_WORD_SIZE;
+  }
+
+  /* Tail */
+  pByte = (u08_t*)pWord;
+  while (0 != uiSizeInBytes)
+  {
+    *pByte++ = uiVal;
+    uiSizeInBytes--;
+  }
 
-   return pMemory;
+  return pMemory;
 }
 
+/**
+* @brief - PSP implementation of memcpy function. The memory areas must not overlap.
+*          When the source and the destination have the same alignment the words are
+*          copied in an unrolled loop. Otherwise each destination word is merged from
+*          two aligned source words, so all the word accesses are aligned
+*
+* @parameter - address of the destination
+* @parameter - address of the source
+* @parameter - number of bytes to copy
+*
+* @return - address of the destination
+*/
+D_PSP_TEXT_SECTION void* pspMemcpy(void* pDestination, const void* pSource, u32_t uiSizeInBytes)
+{
+  u08_t*       pDstByte = (u08_t*)pDestination;
+  const u08_t* pSrcByte = (const u08_t*)pSource;
+  u32_t*       pDstWord;
+  const u32_t* pSrcWord;
+  u32_t        uiShift, uiLow, uiHigh, uiNumOfBytes;
+
+  M_PSP_ASSERT((NULL != pDestination) && (NULL != pSource));
+
+  /* Head - up to the first word boundary of the destination */
+  while ((0 != uiSizeInBytes) && !M_PSP_MEMORY_IS_ALIGNED(pDstByte))
+  {
+    *pDstByte++ = *pSrcByte++;
+    uiSizeInBytes--;
+  }
+
+  pDstWord = (u32_t*)pDstByte;
+  if (M_PSP_MEMORY_IS_ALIGNED(pSrcByte))
+  {
+    /* Body - whole words */
+    pSrcWord = (const u32_t*)pSrcByte;
+    while (D_PSP_MEMORY_UNROLL_SIZE <= uiSizeInBytes)
+    {
+      pDstWord[0] = pSrcWord[0];
+      pDstWord[1] = pSrcWord[1];
+      pDstWord[2] = pSrcWord[2];
+      pDstWord[3] = pSrcWord[3];
+      pDstWord += D_PSP_MEMORY_UNROLL_WORDS;
+      pSrcWord += D_PSP_MEMORY_UNROLL_WORDS;
+      uiSizeInBytes -= D_PSP_MEMORY_UNROLL_SIZE;
+    }
+    while (D_PSP_MEMORY_WORD_SIZE <= uiSizeInBytes)
+    {
+      *pDstWord++ = *pSrcWord++;
+      uiSizeInBytes -= D_PSP_MEMORY_WORD_SIZE;
+    }
+    pSrcByte = (const u08_t*)pSrcWord;
+  }
+  else if (D_PSP_MEMORY_WORD_SIZE <= uiSizeInBytes)
+  {
+    /* Body - merge each destination word from two aligned source words (little endian).
+     * The aligned source words hold no byte beyond the word of the last byte copied */
+    uiShift  = ((u32_t)pSrcByte & D_PSP_MEMORY_WORD_MASK) * 8;
+    pSrcWord = (const u32_t*)((u32_t)pSrcByte & ~D_PSP_MEMORY_WORD_MASK);
+    uiNumOfBytes = uiSizeInBytes & ~D_PSP_MEMORY_WORD_MASK;
+    uiLow = *pSrcWord++;
+    while (D_PSP_MEMORY_WORD_SIZE <= uiSizeInBytes)
+    {
+      uiHigh = *pSrcWord++;
+      *pDstWord++ = (uiLow >> uiShift) | (uiHigh << (D_PSP_MEMORY_WORD_BITS - uiShift));
+      uiLow = uiHigh;
+      uiSizeInBytes -= D_PSP_MEMORY_WORD_SIZE;
+    }
+    pSrcByte += uiNumOfBytes;
+  }
+
+  /* Tail */
+  pDstByte = (u08_t*)pDstWord;
+  while (0 != uiSizeInBytes)
+  {
+    *pDstByte++ = *pSrcByte++;
+    uiSizeInBytes--;
+  }
 
+  return pDestination;
+}
+
+/**
+* @brief - PSP implementation of memmove function. The memory areas may overlap. When the
+*          destination follows the source in an overlap the copy runs backwards
+*
+* @parameter - address of the destination
+* @parameter - address of the source
+* @parameter - number of bytes to copy
+*
+* @return - address of the destination
+*/
+D_PSP_TEXT_SECTION void* pspMemmove(void* pDestination, const void* pSource, u32_t uiSizeInBytes)
+{
+  u08_t*       pDstByte;
+  const u08_t* pSrcByte;
+  u32_t*       pDstWord;
+  const u32_t* pSrcWord;
+
+  M_PSP_ASSERT((NULL != pDestination) && (NULL != pSource));
+
+  /* The forward copy reads each source word before the destination word it may overlap is written */
+  if (((u32_t)pDestination <= (u32_t)pSource) || ((u32_t)pDestination >= ((u32_t)pSource + uiSizeInBytes)))
+  {
+    return pspMemcpy(pDestination, pSource, uiSizeInBytes);
+  }
+
+  /* Backward copy, from the end */
+  pDstByte = (u08_t*)pDestination + uiSizeInBytes;
+  pSrcByte = (const u08_t*)pSource + uiSizeInBytes;
+
+  if (M_PSP_MEMORY_IS_CO_ALIGNED(pDstByte, pSrcByte))
+  {
+    /* Tail - down to the last word boundary */
+    while ((0 != uiSizeInBytes) && !M_PSP_MEMORY_IS_ALIGNED(pDstByte))
+    {
+      *--pDstByte = *--pSrcByte;
+      uiSizeInBytes--;
+    }
+
+    /* Body - whole words */
+    pDstWord = (u32_t*)pDstByte;
+    pSrcWord = (const u32_t*)pSrcByte;
+    while (D_PSP_MEMORY_UNROLL_SIZE <= uiSizeInBytes)
+    {
+      pDstWord -= D_PSP_MEMORY_UNROLL_WORDS;
+      pSrcWord -= D_PSP_MEMORY_UNROLL_WORDS;
+      pDstWord[3] = pSrcWord[3];
+      pDstWord[2] = pSrcWord[2];
+      pDstWord[1] = pSrcWord[1];
+      pDstWord[0] = pSrcWord[0];
+      uiSizeInBytes -= D_PSP_MEMORY_UNROLL_SIZE;
+    }
+    while (D_PSP_MEMORY_WORD_SIZE <= uiSizeInBytes)
+    {
+      *--pDstWord = *--pSrcWord;
+      uiSizeInBytes -= D_PSP_MEMORY_WORD_SIZE;
+    }
+    pDstByte = (u08_t*)pDstWord;
+    pSrcByte = (const u08_t*)pSrcWord;
+  }
+
+  /* Head, or all the bytes when the source and the destination are not co-aligned */
+  while (0 != uiSizeInBytes)
+  {
+    *--pDstByte = *--pSrcByte;
+    uiSizeInBytes--;
+  }
+
+  return pDestination;
+}
+
+/**
+* @brief - PSP implementation of memcmp function. When the two areas have the same alignment
+*          they are compared a word at a time, and the first differing word is compared
+*          byte by byte
+*
+* @parameter - address of the first memory area
+* @parameter - address of the second memory area
+* @parameter - number of bytes to compare
+*
+* @return - 0 if the areas are equal. Otherwise the difference of the first differing bytes
+*           (as unsigned bytes) - negative if the byte of the first area is smaller
+*/
+D_PSP_TEXT_SECTION s32_t pspMemcmp(const void* pMemory1, const void* pMemory2, u32_t uiSizeInBytes)
+{
+  const u08_t* pByte1 = (const u08_t*)pMemory1;
+  const u08_t* pByte2 = (const u08_t*)pMemory2;
+  const u32_t* pWord1;
+  const u32_t* pWord2;
+
+  M_PSP_ASSERT((NULL != pMemory1) && (NULL != pMemory2));
+
+  if (M_PSP_MEMORY_IS_CO_ALIGNED(pByte1, pByte2))
+  {
+    /* Head - up to the first word boundary */
+    while ((0 != uiSizeInBytes) && !M_PSP_MEMORY_IS_ALIGNED(pByte1))
+    {
+      if (*pByte1 != *pByte2)
+      {
+        return (s32_t)*pByte1 - (s32_t)*pByte2;
+      }
+      pByte1++;
+      pByte2++;
+      uiSizeInBytes--;
+    }
+
+    /* Body - skip the equal words. The bytes of the first differing word are compared below */
+    pWord1 = (const u32_t*)pByte1;
+    pWord2 = (const u32_t*)pByte2;
+    while ((D_PSP_MEMORY_WORD_SIZE <= uiSizeInBytes) && (*pWord1 == *pWord2))
+    {
+      pWord1++;
+      pWord2++;
+      uiSizeInBytes -= D_PSP_MEMORY_WORD_SIZE;
+    }
+    pByte1 = (const u08_t*)pWord1;
+    pByte2 = (const u08_t*)pWord2;
+  }
+
+  while (0 != uiSizeInBytes)
+  {
+    if (*pByte1 != *pByte2)
+    {
+      return (s32_t)*pByte1 - (s32_t)*pByte2;
+    }
+    pByte1++;
+    pByte2++;
+    uiSizeInBytes--;
+  }
+
+  return 0;
+}
+
+/**
+* @brief - PSP implementation of strlen function. The string is scanned a word at a time
+*          from its first word boundary. An aligned word never crosses the end of the
+*          memory that holds the terminating zero
+*
+* @parameter - address of the string
+*
+* @return - number of characters before the terminating zero
+*/
+D_PSP_TEXT_SECTION u32_t pspStrlen(const char* pString)
+{
+  const char*  pChar = pString;
+  const u32_t* pWord;
+
+  M_PSP_ASSERT(NULL != pString);
+
+  /* Head - up to the first word boundary */
+  while (!M_PSP_MEMORY_IS_ALIGNED(pChar))
+  {
+    if ('\0' == *pChar)
+    {
+      return (u32_t)(pChar - pString);
+    }
+    pChar++;
+  }
+
+  /* Body - skip the words with no zero byte */
+  pWord = (const u32_t*)pChar;
+  while (!pspMemoryHasZeroByte(*pWord))
+  {
+    pWord++;
+  }
+
+  /* Find the zero byte in the word */
+  pChar = (const char*)pWord;
+  while ('\0' != *pChar)
+  {
+    pChar++;
+  }
+
+  return (u32_t)(pChar - pString);
+}
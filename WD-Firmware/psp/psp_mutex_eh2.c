@@ -38,8 +38,15 @@
 * definitions
 */
 #define D_PSP_SIZE_OF_MUTEX_CB  sizeof(pspMutexCb_t)
-/* Size of mutex CB is 64bits (== 8 bytes). In order to check that an address is aligned to 8 bytes, check that low 3 bits are 0 */
-#define D_PSP_ADDRESS_ALIGN_TO_SIZEOF_MUTEX_CB   0x7
+
+/* Free bitmap of the mutexs-heap: a set bit marks an unoccupied mutex. Mutex n is bit (31 - n%32)
+ * of word n/32, so CLZ finds the first free mutex. A set bit in the summary marks a bitmap word
+ * with a free mutex, so the search takes two CLZ regardless of the heap size */
+#define D_PSP_MUTEX_BITMAP_WORD_BITS     32
+#define D_PSP_MUTEX_BITMAP_NUM_OF_WORDS  ((D_PSP_MUTEX_HEAP_MAX_MUTEXES + D_PSP_MUTEX_BITMAP_WORD_BITS - 1) / D_PSP_MUTEX_BITMAP_WORD_BITS)
+#if D_PSP_MUTEX_BITMAP_NUM_OF_WORDS > D_PSP_MUTEX_BITMAP_WORD_BITS
+  #error "D_PSP_MUTEX_HEAP_MAX_MUTEXES is too big"
+#endif
 /**
 * local prototypes
 */
@@ -51,6 +58,9 @@
 /**
 * macros
 */
+#define M_PSP_MUTEX_BITMAP_BIT(uiBit)        (0x80000000 >> (uiBit))
+#define M_PSP_MUTEX_BITMAP_WORD(uiIndex)     ((uiIndex) / D_PSP_MUTEX_BITMAP_WORD_BITS)
+#define M_PSP_MUTEX_BITMAP_OFFSET(uiIndex)   ((uiIndex) % D_PSP_MUTEX_BITMAP_WORD_BITS)
 
 /**
 * global variables
@@ -59,6 +69,9 @@
 u32_t g_uiAppMutexsHeapAddress;
 /* Number of mutexs in the mutex-heap. This number is set by the application */
 u32_t g_uiAppNumberOfMutexs;
+/* Free bitmap of the mutex-heap and its summary word */
+u32_t g_uiAppMutexsFreeBitmap[D_PSP_MUTEX_BITMAP_NUM_OF_WORDS];
+u32_t g_uiAppMutexsFreeSummary;
 
 /**
 * APIs
@@ -85,10 +98,10 @@ D_PSP_TEXT_SECTION u32_t pspIsMutexAddressValid(u32_t* uiMutexAddress)
 {
   u32_t uiValid = D_PSP_FALSE;
 
-  /* uiMutexAddress is valid if it is inside the mutex Heap and is aligned to mutex size (8bytes) */
+  /* uiMutexAddress is valid if it is inside the mutex Heap and points to the start of a mutex */
   if ((uiMutexAddress >= (u32_t*)g_uiAppMutexsHeapAddress) &&
       (uiMutexAddress < (u32_t*)(g_uiAppMutexsHeapAddress + g_uiAppNumberOfMutexs*D_PSP_SIZE_OF_MUTEX_CB)) &&
-      (0 == (D_PSP_ADDRESS_ALIGN_TO_SIZEOF_MUTEX_CB & (u32_t)uiMutexAddress)))
+      (0 == (((u32_t)uiMutexAddress - g_uiAppMutexsHeapAddress) % D_PSP_SIZE_OF_MUTEX_CB)))
   {
     uiValid = D_PSP_TRUE;
   }
@@ -105,8 +118,10 @@ D_PSP_TEXT_SECTION u32_t pspIsMutexAddressValid(u32_t* uiMutexAddress)
 */
 D_PSP_TEXT_SECTION void pspMutexHeapInit(pspMutexCb_t* pMutexHeapAddress, u32_t uiNumOfmutexs)
 {
-  /* Assert if address is NULL or number of mutexs is 0 */
-  M_PSP_ASSERT((NULL != pMutexHeapAddress) && (0 != uiNumOfmutexs)) ;
+  u32_t uiWord, uiRemaining;
+
+  /* Assert if address is NULL or number of mutexs is 0 or more than the free bitmap can hold */
+  M_PSP_ASSERT((NULL != pMutexHeapAddress) && (0 != uiNumOfmutexs) && (D_PSP_MUTEX_HEAP_MAX_MUTEXES >= uiNumOfmutexs)) ;
 
   /* Protect the mutex-heap initialization. Make sure it cannot be done simultaneously by multiple harts */
   pspInternalMutexLock(E_MUTEX_INTERNAL_FOR_MUTEX_HEAP_MNG);
@@ -118,44 +133,93 @@ D_PSP_TEXT_SECTION void pspMutexHeapInit(pspMutexCb_t* pMutexHeapAddress, u32_t
   g_uiAppMutexsHeapAddress = (u32_t)pMutexHeapAddress;
   g_uiAppNumberOfMutexs    = uiNumOfmutexs;
 
+  /* Mark all the mutexs as free */
+  g_uiAppMutexsFreeSummary = 0;
+  for (uiWord = 0; uiWord < D_PSP_MUTEX_BITMAP_NUM_OF_WORDS; uiWord++)
+  {
+    uiRemaining = (uiWord * D_PSP_MUTEX_BITMAP_WORD_BITS < uiNumOfmutexs) ? (uiNumOfmutexs - uiWord * D_PSP_MUTEX_BITMAP_WORD_BITS) : 0;
+    if (D_PSP_MUTEX_BITMAP_WORD_BITS <= uiRemaining)
+    {
+      g_uiAppMutexsFreeBitmap[uiWord] = 0xFFFFFFFF;
+    }
+    else if (0 != uiRemaining)
+    {
+      g_uiAppMutexsFreeBitmap[uiWord] = ~(0xFFFFFFFF >> uiRemaining);
+    }
+    else
+    {
+      g_uiAppMutexsFreeBitmap[uiWord] = 0;
+    }
+    if (0 != g_uiAppMutexsFreeBitmap[uiWord])
+    {
+      g_uiAppMutexsFreeSummary |= M_PSP_MUTEX_BITMAP_BIT(uiWord);
+    }
+  }
+
   /* Remove the protection */
   pspInternalMutexUnlock(E_MUTEX_INTERNAL_FOR_MUTEX_HEAP_MNG);
 }
 
 /**
-* @brief - Create a mutex in the mutexs-heap.
-*          - Search for an available mutex in the heap
+* @brief - Create a mutex in the mutexs-heap, with the lock algorithm D_PSP_MUTEX_DEFAULT_TYPE.
+*
+* @return - Address of the created mutex. In case of failure return NULL.
+*/
+D_PSP_TEXT_SECTION pspMutexCb_t* pspMutexCreate(void)
+{
+  return pspMutexCreateByType(D_PSP_MUTEX_DEFAULT_TYPE);
+}
+
+/**
+* @brief - Create a mutex in the mutexs-heap, with a given lock algorithm.
+*          - Take the first available mutex from the free bitmap
 *          - Mark it as 'occupied'
 *          - Mark the hart that created it
 *
+* @parameter - Lock algorithm of the mutex (E_PSP_MUTEX_TYPE_XXX)
+*
 * @return - Address of the created mutex. In case of failure return NULL.
 */
-D_PSP_TEXT_SECTION pspMutexCb_t* pspMutexCreate(void)
+D_PSP_TEXT_SECTION pspMutexCb_t* pspMutexCreateByType(u32_t uiMutexType)
 {
-  u32_t             uiMutexIndex;                                     /* Index used for scanning */
+  u32_t             uiWord, uiBit;                                    /* Position of the mutex in the free bitmap */
   pspMutexCb_t*     pRetMutex = NULL;                                 /* Returned pointer to the created mutex */
-  pspMutexCb_t*     pMutex = (pspMutexCb_t*)g_uiAppMutexsHeapAddress; /* Pointer to a mutex control block */
+  pspMutexCb_t*     pMutex;                                           /* Pointer to a mutex control block */
   u32_t             uiHartId = M_PSP_MACHINE_GET_HART_ID();
 
+#ifdef D_PSP_MUTEX_QUEUE_LOCK
+  M_PSP_ASSERT(E_PSP_MUTEX_TYPE_LAST > uiMutexType);
+#else
+  M_PSP_ASSERT(E_PSP_MUTEX_TYPE_QUEUE > uiMutexType);
+#endif /* D_PSP_MUTEX_QUEUE_LOCK */
+
   /* Protect the creation of a mutex. Make sure the creation cannot be done simultaneously by multiple harts */
   pspInternalMutexLock(E_MUTEX_INTERNAL_FOR_MUTEX_HEAP_MNG);
 
-  /* Search for an unoccupied mutex in the mutexs heap */
-  for(uiMutexIndex = 0; uiMutexIndex < g_uiAppNumberOfMutexs; uiMutexIndex++)
+  /* Take the first unoccupied mutex in the mutexs heap */
+  if (0 != g_uiAppMutexsFreeSummary)
   {
-    if(D_PSP_MUTEX_UNOCCUIPED == pMutex->uiMutexOccupied)
+    uiWord = pspBitmanipClz(g_uiAppMutexsFreeSummary);
+    uiBit  = pspBitmanipClz(g_uiAppMutexsFreeBitmap[uiWord]);
+
+    /* Remove the mutex from the free bitmap */
+    g_uiAppMutexsFreeBitmap[uiWord] &= ~M_PSP_MUTEX_BITMAP_BIT(uiBit);
+    if (0 == g_uiAppMutexsFreeBitmap[uiWord])
     {
-      /* Set the address of the found mutex, to be returned */
-      pRetMutex = pMutex;
-      /* Mark the mutex as 'occupied' */
-      pMutex->uiMutexOccupied = D_PSP_MUTEX_OCCUIPED;
-      /* Mark the hart that created the mutex */
-      pMutex->uiMutexCreator = uiHartId;
-      /* Make sure to mark the mutex as 'unlocked' */
-      pMutex->uiMutexState = D_PSP_MUTEX_UNLOCKED;
-      /* mutex is found, break out of the loop*/
-      break;
+      g_uiAppMutexsFreeSummary &= ~M_PSP_MUTEX_BITMAP_BIT(uiWord);
     }
+
+    pMutex = (pspMutexCb_t*)g_uiAppMutexsHeapAddress + (uiWord * D_PSP_MUTEX_BITMAP_WORD_BITS + uiBit);
+    /* Set the address of the found mutex, to be returned */
+    pRetMutex = pMutex;
+    /* Mark the mutex as 'occupied' */
+    pMutex->uiMutexOccupied = D_PSP_MUTEX_OCCUIPED;
+    /* Mark the hart that created the mutex */
+    pMutex->uiMutexCreator = uiHartId;
+    /* Set the lock algorithm of the mutex */
+    pMutex->uiMutexType = uiMutexType;
+    /* Make sure to mark the mutex as 'unlocked' (0 - for all the lock algorithms) */
+    pMutex->uiMutexState = D_PSP_MUTEX_UNLOCKED;
   }
 
   /* Remove the protection */
@@ -176,6 +240,7 @@ D_PSP_TEXT_SECTION pspMutexCb_t* pspMutexDestroy(pspMutexCb_t* pMutex)
 {
   pspMutexCb_t* pRetMutexAddr;  /* Pointer to a mutex. Used for return value */
   u32_t         uiHartId = M_PSP_MACHINE_GET_HART_ID();
+  u32_t         uiMutexIndex;
 
   /* Verify mutex address validity*/
   M_PSP_ASSERT(D_PSP_TRUE == pspIsMutexAddressValid(pMutex));
@@ -186,6 +251,11 @@ D_PSP_TEXT_SECTION pspMutexCb_t* pspMutexDestroy(pspMutexCb_t* pMutex)
   /* Only the hart that created this mutex can also destroy it */
   if (uiHartId == pMutex->uiMutexCreator)
   {
+    /* Return the mutex to the free bitmap */
+    uiMutexIndex = pMutex - (pspMutexCb_t*)g_uiAppMutexsHeapAddress;
+    g_uiAppMutexsFreeBitmap[M_PSP_MUTEX_BITMAP_WORD(uiMutexIndex)] |= M_PSP_MUTEX_BITMAP_BIT(M_PSP_MUTEX_BITMAP_OFFSET(uiMutexIndex));
+    g_uiAppMutexsFreeSummary |= M_PSP_MUTEX_BITMAP_BIT(M_PSP_MUTEX_BITMAP_WORD(uiMutexIndex));
+
     pMutex->uiMutexOccupied = D_PSP_MUTEX_UNOCCUIPED;  /* mark the mutex as 'unoccupied' */
     pMutex->uiMutexCreator  = 0;                       /* clean the 'creator' field */
     pMutex->uiMutexState    = D_PSP_MUTEX_UNLOCKED;    /* set the mutex state to 'free' */
@@ -215,7 +285,20 @@ D_PSP_TEXT_SECTION void pspMutexAtomicLock(pspMutexCb_t* pMutex)
   M_PSP_ASSERT(D_PSP_TRUE == pspIsMutexAddressValid(pMutex));
 
   /* Lock the mutex */
-  M_PSP_ATOMIC_ENTER_CRITICAL_SECTION(&(pMutex->uiMutexState));
+  switch (pMutex->uiMutexType)
+  {
+    case E_PSP_MUTEX_TYPE_TICKET:
+      M_PSP_ATOMIC_ENTER_CRITICAL_SECTION_TICKET(&(pMutex->uiMutexState));
+      break;
+#ifdef D_PSP_MUTEX_QUEUE_LOCK
+    case E_PSP_MUTEX_TYPE_QUEUE:
+      pspAtomicsEnterCriticalSectionQueue(&(pMutex->uiMutexState), pMutex->uiQueueNext, pMutex->uiQueueWait);
+      break;
+#endif /* D_PSP_MUTEX_QUEUE_LOCK */
+    default:
+      M_PSP_ATOMIC_ENTER_CRITICAL_SECTION(&(pMutex->uiMutexState));
+      break;
+  }
 }
 
 /**
@@ -230,5 +313,307 @@ D_PSP_TEXT_SECTION void pspMutexAtomicUnlock(pspMutexCb_t* pMutex)
   M_PSP_ASSERT(D_PSP_TRUE == pspIsMutexAddressValid(pMutex));
 
   /* Unlock the mutex */
-  M_PSP_ATOMIC_EXIT_CRITICAL_SECTION(&(pMutex->uiMutexState));
+  switch (pMutex->uiMutexType)
+  {
+    case E_PSP_MUTEX_TYPE_TICKET:
+      M_PSP_ATOMIC_EXIT_CRITICAL_SECTION_TICKET(&(pMutex->uiMutexState));
+      break;
+#ifdef D_PSP_MUTEX_QUEUE_LOCK
+    case E_PSP_MUTEX_TYPE_QUEUE:
+      pspAtomicsExitCriticalSectionQueue(&(pMutex->uiMutexState), pMutex->uiQueueNext, pMutex->uiQueueWait);
+      break;
+#endif /* D_PSP_MUTEX_QUEUE_LOCK */
+    default:
+      M_PSP_ATOMIC_EXIT_CRITICAL_SECTION(&(pMutex->uiMutexState));
+      break;
+  }
+}
+
+/**
+* @brief - Initialize a reader-writer lock to unlocked
+*
+* @parameter - pointer to the reader-writer lock
+*
+*/
+D_PSP_TEXT_SECTION void pspMutexRwInit(pspMutexRw_t* pRwLock)
+{
+  M_PSP_ASSERT(NULL != pRwLock);
+
+  pRwLock->uiRwState = 0;
+}
+
+/**
+* @brief - Lock a reader-writer lock for read. Other readers may hold the lock at the same time.
+*          While a writer holds or waits for the lock, wait with bounded exponential backoff
+*
+* @parameter - pointer to the reader-writer lock
+*
+*/
+D_PSP_TEXT_SECTION void pspMutexRwReadLock(pspMutexRw_t* pRwLock)
+{
+  u32_t uiBackoff = D_PSP_ATOMICS_BACKOFF_MIN;
+
+  M_PSP_ASSERT(NULL != pRwLock);
+
+  while (1)
+  {
+    /* Wait with plain loads while there is a writer, so the lock word is not hammered with AMOs */
+    while (0 != (pRwLock->uiRwState & D_PSP_MUTEX_RW_WRITER))
+    {
+      pspAtomicsBackoff(uiBackoff);
+      if (D_PSP_ATOMICS_BACKOFF_MAX > uiBackoff)
+      {
+        uiBackoff <<= 1;
+      }
+    }
+
+    /* Join the readers. A writer that came in meanwhile takes precedence - leave and wait for it */
+    if (0 == (pspAtomicsInlineAmoAdd((u32_t*)&pRwLock->uiRwState, 1) & D_PSP_MUTEX_RW_WRITER))
+    {
+      break;
+    }
+    pspAtomicsInlineAmoAdd((u32_t*)&pRwLock->uiRwState, (u32_t)-1);
+  }
+
+  /* Acquire - the protected data is not read before the lock is taken */
+  M_PSP_ATOMICS_FENCE_ACQUIRE();
+}
+
+/**
+* @brief - Unlock a reader-writer lock that was locked for read
+*
+* @parameter - pointer to the reader-writer lock
+*
+*/
+D_PSP_TEXT_SECTION void pspMutexRwReadUnlock(pspMutexRw_t* pRwLock)
+{
+  M_PSP_ASSERT((NULL != pRwLock) && (0 != (pRwLock->uiRwState & D_PSP_MUTEX_RW_READERS_MASK)));
+
+  /* Release - the protected data is read before the lock is released */
+  M_PSP_ATOMICS_FENCE_RELEASE();
+  pspAtomicsInlineAmoAdd((u32_t*)&pRwLock->uiRwState, (u32_t)-1);
+}
+
+/**
+* @brief - Lock a reader-writer lock for write. Waits until the readers that hold the lock
+*          release it. New readers wait from the moment the writer bit is set
+*
+* @parameter - pointer to the reader-writer lock
+*
+*/
+D_PSP_TEXT_SECTION void pspMutexRwWriteLock(pspMutexRw_t* pRwLock)
+{
+  u32_t uiBackoff = D_PSP_ATOMICS_BACKOFF_MIN;
+
+  M_PSP_ASSERT(NULL != pRwLock);
+
+  /* Take the writer bit. Another writer may hold it */
+  while (0 != (pspAtomicsInlineAmoOr((u32_t*)&pRwLock->uiRwState, D_PSP_MUTEX_RW_WRITER) & D_PSP_MUTEX_RW_WRITER))
+  {
+    do
+    {
+      pspAtomicsBackoff(uiBackoff);
+      if (D_PSP_ATOMICS_BACKOFF_MAX > uiBackoff)
+      {
+        uiBackoff <<= 1;
+      }
+    } while (0 != (pRwLock->uiRwState & D_PSP_MUTEX_RW_WRITER));
+  }
+
+  /* Wait for the readers to leave */
+  uiBackoff = D_PSP_ATOMICS_BACKOFF_MIN;
+  while (0 != (pRwLock->uiRwState & D_PSP_MUTEX_RW_READERS_MASK))
+  {
+    pspAtomicsBackoff(uiBackoff);
+    if (D_PSP_ATOMICS_BACKOFF_MAX > uiBackoff)
+    {
+      uiBackoff <<= 1;
+    }
+  }
+
+  /* Acquire - the protected data is not accessed before the readers left */
+  M_PSP_ATOMICS_FENCE_ACQUIRE();
+}
+
+/**
+* @brief - Unlock a reader-writer lock that was locked for write
+*
+* @parameter - pointer to the reader-writer lock
+*
+*/
+D_PSP_TEXT_SECTION void pspMutexRwWriteUnlock(pspMutexRw_t* pRwLock)
+{
+  M_PSP_ASSERT((NULL != pRwLock) && (0 != (pRwLock->uiRwState & D_PSP_MUTEX_RW_WRITER)));
+
+  /* Release - the protected data is written before the lock is released. Readers that
+   * back off concurrently update the readers count, so clear the writer bit atomically */
+  M_PSP_ATOMICS_FENCE_RELEASE();
+  pspAtomicsInlineAmoAnd((u32_t*)&pRwLock->uiRwState, ~D_PSP_MUTEX_RW_WRITER);
+}
+
+/**
+* @brief - Initialize a sequence lock
+*
+* @parameter - pointer to the sequence lock
+*
+*/
+D_PSP_TEXT_SECTION void pspMutexSeqInit(pspMutexSeq_t* pSeqLock)
+{
+  M_PSP_ASSERT(NULL != pSeqLock);
+
+  pSeqLock->uiSequence = 0;
+}
+
+/**
+* @brief - Start a write section of a sequence lock. The sequence is made odd with a
+*          compare-and-swap, so writers exclude each other
+*
+* @parameter - pointer to the sequence lock
+*
+*/
+D_PSP_TEXT_SECTION void pspMutexSeqWriteBegin(pspMutexSeq_t* pSeqLock)
+{
+  u32_t uiSequence;
+  u32_t uiBackoff = D_PSP_ATOMICS_BACKOFF_MIN;
+
+  M_PSP_ASSERT(NULL != pSeqLock);
+
+  while (1)
+  {
+    uiSequence = pSeqLock->uiSequence;
+    if ((0 == (uiSequence & 1)) &&
+        (uiSequence == pspAtomicsInlineCompareAndSwap((u32_t*)&pSeqLock->uiSequence, uiSequence, uiSequence + 1)))
+    {
+      break;
+    }
+
+    /* Another writer is in its write section */
+    pspAtomicsBackoff(uiBackoff);
+    if (D_PSP_ATOMICS_BACKOFF_MAX > uiBackoff)
+    {
+      uiBackoff <<= 1;
+    }
+  }
+
+  /* Release - the odd sequence is visible before the protected data is written */
+  M_PSP_ATOMICS_FENCE_RELEASE();
+}
+
+/**
+* @brief - End a write section of a sequence lock
+*
+* @parameter - pointer to the sequence lock
+*
+*/
+D_PSP_TEXT_SECTION void pspMutexSeqWriteEnd(pspMutexSeq_t* pSeqLock)
+{
+  M_PSP_ASSERT((NULL != pSeqLock) && (0 != (pSeqLock->uiSequence & 1)));
+
+  /* Release - the protected data is written before the sequence is made even */
+  M_PSP_ATOMICS_FENCE_RELEASE();
+  pSeqLock->uiSequence = pSeqLock->uiSequence + 1;
+}
+
+/**
+* @brief - Start a read section of a sequence lock. Waits while a write is in progress
+*
+* @parameter - pointer to the sequence lock
+*
+* @return    - sequence to pass to pspMutexSeqReadRetry
+*/
+D_PSP_TEXT_SECTION u32_t pspMutexSeqReadBegin(pspMutexSeq_t* pSeqLock)
+{
+  u32_t uiSequence;
+
+  M_PSP_ASSERT(NULL != pSeqLock);
+
+  do
+  {
+    uiSequence = pSeqLock->uiSequence;
+  } while (0 != (uiSequence & 1));
+
+  /* Acquire - the protected data is not read before the sequence */
+  M_PSP_ATOMICS_FENCE_ACQUIRE();
+
+  return uiSequence;
+}
+
+/**
+* @brief - End a read section of a sequence lock
+*
+* @parameter - pointer to the sequence lock
+* @parameter - sequence returned by pspMutexSeqReadBegin
+*
+* @return    - D_PSP_TRUE - a write overlapped the read section, and it must be retried. D_PSP_FALSE - otherwise
+*/
+D_PSP_TEXT_SECTION u32_t pspMutexSeqReadRetry(pspMutexSeq_t* pSeqLock, u32_t uiSequence)
+{
+  /* Acquire - the protected data is read before the sequence is read again */
+  M_PSP_ATOMICS_FENCE_ACQUIRE();
+
+  return (uiSequence != pSeqLock->uiSequence) ? D_PSP_TRUE : D_PSP_FALSE;
+}
+
+/**
+* @brief - Initialize a 64-bit counter to 0
+*
+* @parameter - pointer to the counter
+*
+*/
+D_PSP_TEXT_SECTION void pspMutexCounter64Init(pspMutexCounter64_t* pCounter)
+{
+  M_PSP_ASSERT(NULL != pCounter);
+
+  pspMutexSeqInit(&pCounter->stSeq);
+  pCounter->uiLow  = 0;
+  pCounter->uiHigh = 0;
+}
+
+/**
+* @brief - Add a value to a 64-bit counter. Can be called by any hart
+*
+* @parameter - pointer to the counter
+* @parameter - value to add
+*
+*/
+D_PSP_TEXT_SECTION void pspMutexCounter64Add(pspMutexCounter64_t* pCounter, u32_t uiValue)
+{
+  u32_t uiLow;
+
+  M_PSP_ASSERT(NULL != pCounter);
+
+  pspMutexSeqWriteBegin(&pCounter->stSeq);
+
+  uiLow = pCounter->uiLow + uiValue;
+  /* Carry to the upper half */
+  if (uiLow < uiValue)
+  {
+    pCounter->uiHigh = pCounter->uiHigh + 1;
+  }
+  pCounter->uiLow = uiLow;
+
+  pspMutexSeqWriteEnd(&pCounter->stSeq);
+}
+
+/**
+* @brief - Read a 64-bit counter. The two halves are read from the same update
+*
+* @parameter - pointer to the counter
+*
+* @return    - value of the counter
+*/
+D_PSP_TEXT_SECTION u64_t pspMutexCounter64Read(pspMutexCounter64_t* pCounter)
+{
+  u32_t uiSequence, uiLow, uiHigh;
+
+  M_PSP_ASSERT(NULL != pCounter);
+
+  do
+  {
+    uiSequence = pspMutexSeqReadBegin(&pCounter->stSeq);
+    uiLow  = pCounter->uiLow;
+    uiHigh = pCounter->uiHigh;
+  } while (D_PSP_TRUE == pspMutexSeqReadRetry(&pCounter->stSeq, uiSequence));
+
+  return (((u64_t)uiHigh) << 32) | uiLow;
 }
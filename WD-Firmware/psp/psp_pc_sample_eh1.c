@@ -0,0 +1,255 @@
+/*
+* SPDX-License-Identifier: Apache-2.0
+* Copyright 2026 Western Digital Corporation or its affiliates.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http:*www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+/**
+* @file   psp_pc_sample_eh1.c
+* @author Western Digital
+* @date   16.10.2026
+* @brief  The file supplies the PC-sampling profiler of SweRV cores. The internal timer
+*         interrupt reads mepc and takes the return address from the register frame the
+*         vector table pushed for the interrupted code. When the ring buffer is full the
+*         oldest samples are overwritten, so it always holds the latest ones
+*/
+
+/**
+* include files
+*/
+#include "psp_api.h"
+
+/**
+* definitions
+*/
+/* Location of ra (x1) in the register frame pushed by M_PSP_PUSH_INT_REGFILE */
+#define D_PSP_PC_SAMPLE_RA_LOC_IN_FRAME     3
+
+/* Location of the application sp below the ISR stack top (M_PSP_CHANGE_SP_FROM_APP_TO_ISR_STACK) */
+#define D_PSP_PC_SAMPLE_APP_SP_LOC_IN_ISR_STACK   4
+
+/**
+* macros
+*/
+#ifdef D_SWERV_EH2
+  #define M_PSP_PC_SAMPLE_HART_ID()    M_PSP_MACHINE_GET_HART_ID()
+#else
+  #define M_PSP_PC_SAMPLE_HART_ID()    0
+#endif
+
+/**
+* types
+*/
+
+/**
+* local prototypes
+*/
+D_PSP_TEXT_SECTION pspStack_t* pspPcSampleDefaultFrameGet(u32_t* pContext);
+
+/**
+* external prototypes
+*/
+/* Top of the ISR stack - defined with the interrupt handlers */
+#ifdef D_SWERV_EH2
+  extern const pspStack_t xISRStackTopPerHart[D_PSP_NUM_OF_HARTS];
+#else
+  extern const pspStack_t xISRStackTop;
+#endif
+
+/**
+* global variables
+*/
+/* Ring buffer per hart. Can be dumped by the debugger */
+D_PSP_DCCM_DATA_SECTION pspPcSampleBuffer_t g_stPspPcSampleBuffer[D_PSP_NUM_OF_HARTS];
+
+/**
+* APIs
+*/
+
+/**
+* @brief - Frame of the code interrupted into the PSP vector table. The vector table
+*          saves the application sp at the bottom of the ISR stack frame
+*
+* @parameter - pContext  - output - context id, always 0
+* @return    - register frame of the interrupted code
+*/
+D_PSP_TEXT_SECTION pspStack_t* pspPcSampleDefaultFrameGet(u32_t* pContext)
+{
+  pspStack_t* pIsrStackTop;
+
+#ifdef D_SWERV_EH2
+  pIsrStackTop = (pspStack_t*)xISRStackTopPerHart[M_PSP_PC_SAMPLE_HART_ID()];
+#else
+  pIsrStackTop = (pspStack_t*)xISRStackTop;
+#endif
+
+  *pContext = 0;
+
+  return (pspStack_t*)*(pIsrStackTop - D_PSP_PC_SAMPLE_APP_SP_LOC_IN_ISR_STACK);
+}
+
+/**
+* @brief - Next sampling period - the period with random jitter (xorshift32)
+*
+* @parameter - pBuffer - the ring buffer of the hart
+* @return    - period in cycles
+*/
+D_PSP_ALWAYS_INLINE u32_t pspPcSampleNextPeriod(pspPcSampleBuffer_t* pBuffer)
+{
+  u32_t uiSeed = pBuffer->uiJitterSeed;
+
+  uiSeed ^= uiSeed << 13;
+  uiSeed ^= uiSeed >> 17;
+  uiSeed ^= uiSeed << 5;
+  pBuffer->uiJitterSeed = uiSeed;
+
+  return pBuffer->uiPeriodCycles + (uiSeed & D_PSP_PC_SAMPLE_JITTER_MASK);
+}
+
+/**
+* @brief - Clear the ring buffer of the current hart and start sampling it on an internal
+*          timer. The machine interrupts must be enabled by the caller
+*
+* @parameter - uiTimer        - D_PSP_INTERNAL_TIMER0 or D_PSP_INTERNAL_TIMER1
+* @parameter - uiPeriodCycles - sampling period in cycles
+* @parameter - fptrFrameGet   - frame and context of the interrupted code. NULL - the PSP
+*                               vector table, context 0
+* @return    - none
+*/
+D_PSP_TEXT_SECTION void pspPcSampleStart(u32_t uiTimer, u32_t uiPeriodCycles, fptrPspPcSampleFrameGet_t fptrFrameGet)
+{
+  pspPcSampleBuffer_t* pBuffer = &g_stPspPcSampleBuffer[M_PSP_PC_SAMPLE_HART_ID()];
+  u32_t uiInterruptsState;
+
+  M_PSP_ASSERT(((D_PSP_INTERNAL_TIMER0 == uiTimer) || (D_PSP_INTERNAL_TIMER1 == uiTimer)) && (0 != uiPeriodCycles));
+
+  pspMachineInterruptsDisable(&uiInterruptsState);
+
+  pBuffer->uiNumOfWritten = 0;
+  pBuffer->uiNumOfRead = 0;
+  pBuffer->uiNumOfLost = 0;
+  pBuffer->uiTimer = uiTimer;
+  pBuffer->uiPeriodCycles = uiPeriodCycles;
+  /* Any non-zero seed; mcycle differs between the harts */
+  pBuffer->uiJitterSeed = M_PSP_READ_CSR(D_PSP_MCYCLE_NUM) | 1;
+  pBuffer->fptrFrameGet = (NULL == fptrFrameGet) ? pspPcSampleDefaultFrameGet : fptrFrameGet;
+
+  if (D_PSP_INTERNAL_TIMER0 == uiTimer)
+  {
+    pspMachineInterruptsRegisterIsr(pspPcSampleTake, E_MACHINE_INTERNAL_TIMER0_CAUSE);
+    pspMachineInterruptsEnableIntNumber(D_PSP_INTERRUPTS_MACHINE_INTERNAL_TIMER0);
+  }
+  else
+  {
+    pspMachineInterruptsRegisterIsr(pspPcSampleTake, E_MACHINE_INTERNAL_TIMER1_CAUSE);
+    pspMachineInterruptsEnableIntNumber(D_PSP_INTERRUPTS_MACHINE_INTERNAL_TIMER1);
+  }
+  pspMachineInternalTimerCounterSetup(uiTimer, pspPcSampleNextPeriod(pBuffer));
+  pspMachineInternalTimerRun(uiTimer);
+
+  pspMachineInterruptsRestore(uiInterruptsState);
+}
+
+/**
+* @brief - Stop sampling the current hart. The samples stay in the ring buffer
+*
+* @parameter - none
+* @return    - none
+*/
+D_PSP_TEXT_SECTION void pspPcSampleStop(void)
+{
+  pspPcSampleBuffer_t* pBuffer = &g_stPspPcSampleBuffer[M_PSP_PC_SAMPLE_HART_ID()];
+  u32_t uiInterruptsState;
+
+  pspMachineInterruptsDisable(&uiInterruptsState);
+
+  pspMachineInternalTimerPause(pBuffer->uiTimer);
+  if (D_PSP_INTERNAL_TIMER0 == pBuffer->uiTimer)
+  {
+    pspMachineInterruptsDisableIntNumber(D_PSP_INTERRUPTS_MACHINE_INTERNAL_TIMER0);
+  }
+  else
+  {
+    pspMachineInterruptsDisableIntNumber(D_PSP_INTERRUPTS_MACHINE_INTERNAL_TIMER1);
+  }
+
+  pspMachineInterruptsRestore(uiInterruptsState);
+}
+
+/**
+* @brief - Take a sample of the interrupted code. Called from the internal timer interrupt
+*
+* @parameter - none
+* @return    - none
+*/
+D_PSP_TEXT_SECTION void pspPcSampleTake(void)
+{
+  u32_t uiHartId = M_PSP_PC_SAMPLE_HART_ID();
+  pspPcSampleBuffer_t* pBuffer = &g_stPspPcSampleBuffer[uiHartId];
+  pspPcSample_t* pSample = &pBuffer->stSample[pBuffer->uiNumOfWritten & (D_PSP_PC_SAMPLE_BUFFER_SIZE - 1)];
+  pspStack_t* pFrame;
+
+  pSample->uiPc = M_PSP_READ_CSR(D_PSP_MEPC_NUM);
+  pFrame = pBuffer->fptrFrameGet(&pSample->uiContext);
+  pSample->uiRa = pFrame[D_PSP_PC_SAMPLE_RA_LOC_IN_FRAME];
+  pSample->uiHartId = uiHartId;
+
+  pBuffer->uiNumOfWritten++;
+  /* Full - the oldest unread sample was overwritten */
+  if (D_PSP_PC_SAMPLE_BUFFER_SIZE < (pBuffer->uiNumOfWritten - pBuffer->uiNumOfRead))
+  {
+    pBuffer->uiNumOfRead++;
+    pBuffer->uiNumOfLost++;
+  }
+
+#if (0 != D_PSP_PC_SAMPLE_JITTER_MASK)
+  /* The timer restarts from 0 - the next sample is a new random period from now */
+  pspMachineInternalTimerCounterSetup(pBuffer->uiTimer, pspPcSampleNextPeriod(pBuffer));
+  pspMachineInternalTimerRun(pBuffer->uiTimer);
+#endif
+}
+
+/**
+* @brief - Read the oldest unread samples of the current hart out of the ring buffer
+*
+* @parameter - pSamples      - output - up to uiMaxSamples samples, oldest first
+* @parameter - uiMaxSamples  - number of entries in pSamples
+* @parameter - pNumOfLost    - output - samples overwritten before they were read. May be NULL
+* @return    - number of samples read
+*/
+D_PSP_TEXT_SECTION u32_t pspPcSampleRead(pspPcSample_t* pSamples, u32_t uiMaxSamples, u32_t* pNumOfLost)
+{
+  pspPcSampleBuffer_t* pBuffer = &g_stPspPcSampleBuffer[M_PSP_PC_SAMPLE_HART_ID()];
+  u32_t uiInterruptsState, uiNumOfSamples = 0;
+
+  M_PSP_ASSERT(NULL != pSamples);
+
+  /* The ring buffer is written from the timer interrupt of this hart */
+  pspMachineInterruptsDisable(&uiInterruptsState);
+
+  while ((uiNumOfSamples < uiMaxSamples) && (pBuffer->uiNumOfRead != pBuffer->uiNumOfWritten))
+  {
+    pSamples[uiNumOfSamples] = pBuffer->stSample[pBuffer->uiNumOfRead & (D_PSP_PC_SAMPLE_BUFFER_SIZE - 1)];
+    pBuffer->uiNumOfRead++;
+    uiNumOfSamples++;
+  }
+
+  if (NULL != pNumOfLost)
+  {
+    *pNumOfLost = pBuffer->uiNumOfLost;
+  }
+
+  pspMachineInterruptsRestore(uiInterruptsState);
+
+  return uiNumOfSamples;
+}
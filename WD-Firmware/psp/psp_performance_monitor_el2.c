@@ -176,31 +176,25 @@ D_PSP_TEXT_SECTION u64_t pspMachinePerfCounterGet(u32_t uiCounter)
   switch (uiCounter)
   {
     case D_PSP_CYCLE_COUNTER:
-      uiCounterVal  = (u64_t)M_PSP_READ_CSR(D_PSP_MCYCLE_NUM);                    /* read low 32 bits */
-      uiCounterVal |= (u64_t)M_PSP_READ_CSR(D_PSP_MCYCLEH_NUM) << D_PSP_SHIFT_32; /* read high 32 bits */
+      uiCounterVal = M_PSP_READ_CSR64(D_PSP_MCYCLE_NUM, D_PSP_MCYCLEH_NUM);
       break;
     case D_PSP_TIME_COUNTER:
       uiCounterVal = pspMachineTimerCounterGet();
       break;
     case D_PSP_INSTRET_COUNTER:
-      uiCounterVal  = (u64_t)M_PSP_READ_CSR(D_PSP_MINSTRET_NUM);                    /* read low 32 bits */
-      uiCounterVal |= (u64_t)M_PSP_READ_CSR(D_PSP_MINSTRETH_NUM) << D_PSP_SHIFT_32; /* read high 32 bits */
+      uiCounterVal = M_PSP_READ_CSR64(D_PSP_MINSTRET_NUM, D_PSP_MINSTRETH_NUM);
       break;
     case D_PSP_COUNTER0:
-      uiCounterVal  = (u64_t)M_PSP_READ_CSR(D_PSP_MHPMCOUNTER3_NUM);                    /* read low 32 bits */
-      uiCounterVal |= (u64_t)M_PSP_READ_CSR(D_PSP_MHPMCOUNTER3H_NUM) << D_PSP_SHIFT_32; /* read high 32 bits */
+      uiCounterVal = M_PSP_READ_CSR64(D_PSP_MHPMCOUNTER3_NUM, D_PSP_MHPMCOUNTER3H_NUM);
       break;
     case D_PSP_COUNTER1:
-      uiCounterVal  = (u64_t)M_PSP_READ_CSR(D_PSP_MHPMCOUNTER4_NUM);                    /* read low 32 bits */
-      uiCounterVal |= (u64_t)M_PSP_READ_CSR(D_PSP_MHPMCOUNTER4H_NUM) << D_PSP_SHIFT_32; /* read high 32 bits */
+      uiCounterVal = M_PSP_READ_CSR64(D_PSP_MHPMCOUNTER4_NUM, D_PSP_MHPMCOUNTER4H_NUM);
       break;
     case D_PSP_COUNTER2:
-      uiCounterVal  = (u64_t)M_PSP_READ_CSR(D_PSP_MHPMCOUNTER5_NUM);                    /* read low 32 bits */
-      uiCounterVal |= (u64_t)M_PSP_READ_CSR(D_PSP_MHPMCOUNTER5H_NUM) << D_PSP_SHIFT_32; /* read high 32 bits */
+      uiCounterVal = M_PSP_READ_CSR64(D_PSP_MHPMCOUNTER5_NUM, D_PSP_MHPMCOUNTER5H_NUM);
       break;
     case D_PSP_COUNTER3:
-      uiCounterVal  = (u64_t)M_PSP_READ_CSR(D_PSP_MHPMCOUNTER6_NUM);                    /* read low 32 bits */
-      uiCounterVal |= (u64_t)M_PSP_READ_CSR(D_PSP_MHPMCOUNTER6H_NUM) << D_PSP_SHIFT_32; /* read high 32 bits */
+      uiCounterVal = M_PSP_READ_CSR64(D_PSP_MHPMCOUNTER6_NUM, D_PSP_MHPMCOUNTER6H_NUM);
       break;
     default:
       M_PSP_ASSERT(1);
@@ -208,3 +202,44 @@ D_PSP_TEXT_SECTION u64_t pspMachinePerfCounterGet(u32_t uiCounter)
   }
   return uiCounterVal;
 }
+
+/**
+* @brief The function takes a snapshot of a set of counters. The counters are stopped through
+*        MCOUNTINHIBIT while they are read, so all of them are taken at the same instant, and
+*        then resumed (the counters that were already stopped stay stopped).
+*        The time counter (mtime) cannot be stopped - it is read while the others are stopped
+*
+* @param uiCounters   – bitmap of the counters to read (D_PSP_CYCLE_COUNTER, D_PSP_TIME_COUNTER,
+*                       D_PSP_INSTRET_COUNTER, D_PSP_COUNTER0..3)
+* @param pValues      – output - D_PSP_NUM_OF_PERF_COUNTERS entries. Entry n gets the value of
+*                       the counter of bit n
+*
+* @return No return value
+*/
+D_PSP_TEXT_SECTION void pspMachinePerfCounterSnapshot(u32_t uiCounters, u64_t* pValues)
+{
+  u32_t uiInhibited, uiIntState, uiRemaining, uiCounter;
+  u32_t uiStopped = uiCounters & ~D_PSP_TIME_COUNTER;
+
+  M_PSP_ASSERT((NULL != pValues) && (0 == (uiCounters >> D_PSP_NUM_OF_PERF_COUNTERS)));
+
+  /* An interrupt would keep the counters stopped for its duration */
+  pspMachineInterruptsDisable(&uiIntState);
+
+  /* Stop the chosen counters with a single CSR access */
+  M_PSP_READ_AND_SET_CSR(uiInhibited, D_PSP_MCOUNTINHIBIT_NUM, uiStopped);
+
+  /* Read the chosen counters. A stopped counter does not wrap, so each read takes one try */
+  uiRemaining = uiCounters;
+  while (0 != uiRemaining)
+  {
+    uiCounter = pspBitmanipCtz(uiRemaining);
+    pValues[uiCounter] = pspMachinePerfCounterGet(M_PSP_BIT_MASK(uiCounter));
+    uiRemaining = pspBitmanipBitClear(uiRemaining, uiCounter);
+  }
+
+  /* Resume only the counters that were stopped here */
+  M_PSP_CLEAR_CSR(D_PSP_MCOUNTINHIBIT_NUM, uiStopped & ~uiInhibited);
+
+  pspMachineInterruptsRestore(uiIntState);
+}
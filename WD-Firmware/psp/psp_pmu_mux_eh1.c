@@ -0,0 +1,345 @@
+/*
+* SPDX-License-Identifier: Apache-2.0
+* Copyright 2026 Western Digital Corporation or its affiliates.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http:*www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+/**
+* @file   psp_pmu_mux_eh1.c
+* @author Western Digital
+* @date   16.10.2026
+* @brief  The file supplies the PMU event multiplexer of SweRV cores. On each rotation
+*         the counts of the group on the counters and the cycles it was there are
+*         accumulated, and the events of the next group are programmed. The counters
+*         are not cleared - the counts are the differences of their low 32 bits
+*/
+
+/**
+* include files
+*/
+#include "psp_api.h"
+
+/**
+* definitions
+*/
+
+/**
+* macros
+*/
+
+/**
+* types
+*/
+
+/**
+* local prototypes
+*/
+D_PSP_TEXT_SECTION void pspPmuMuxTimerIsr(void);
+
+/**
+* external prototypes
+*/
+
+/**
+* global variables
+*/
+D_PSP_DATA_SECTION pspPmuMux_t g_stPspPmuMux;
+
+/* All the events of the core - multiplexed when no events are given */
+static const u32_t g_uiPspPmuMuxAllEvents[] =
+{
+  D_CYCLES_CLOCKS_ACTIVE, D_I_CACHE_HITS, D_I_CACHE_MISSES, D_INSTR_COMMITTED_ALL,
+  D_INSTR_COMMITTED_16BIT, D_INSTR_COMMITTED_32BIT, D_INSTR_ALLIGNED_ALL, D_INSTR_DECODED_ALL,
+  D_MULS_COMMITTED, D_DIVS_COMMITTED, D_LOADS_COMMITED, D_STORES_COMMITTED,
+  D_MISALIGNED_LOADS, D_MISALIGNED_STORES, D_ALUS_COMMITTED, D_CSR_READ,
+  D_CSR_READ_WRITE, D_WRITE_RD_0, D_EBREAK, D_ECALL,
+  D_FENCE, D_FENCE_I, D_MRET, D_BRANCHES_COMMITTED,
+  D_BRANCHES_MISPREDICTED, D_BRANCHES_TAKEN, D_UNPREDICTABLE_BRANCHES, D_CYCLES_FETCH_STALLED,
+  D_CYCLES_ALIGNER_STALLED, D_CYCLE_DECODE_STALLED, D_CYCLE_POSTSYNC_STALLED, D_CYCLE_PRESYNC_STALLED,
+  D_CYCLE_FROZEN, D_CYCLES_SB_WB_STALLED, D_CYCLES_DMA_DCCM_TRANSACTION_STALLED, D_CYCLES_DMA_ICCM_TRANSACTION_STALLED,
+  D_EXCEPTIONS_TAKEN, D_TIMER_INTERRUPTS_TAKEN, D_EXTERNAL_INTERRUPTS_TAKEN, D_TLU_FLUSHES,
+  D_BRANCH_FLUSHES, D_I_BUS_TRANSACTIONS_INSTR, D_D_BUD_TRANSACTIONS_LD_ST, D_D_BUS_TRANSACTIONS_MISALIGNED,
+  D_I_BUS_ERRORS, D_D_BUS_ERRORS, D_CYCLES_STALLED_DUE_TO_I_BUS_BUSY, D_CYCLES_STALLED_DUE_TO_D_BUS_BUSY,
+  D_CYCLES_INTERRUPTS_DISABLED, D_CYCLES_INTERRUPTS_STALLED_WHILE_DISABLED,
+#ifdef D_SWERV_EL2
+  D_BITMANIP_COMMITED, D_BUS_LOADS_COMMITED, D_BUS_STORES_COMMITED, D_CYCLES_IN_SLEEP_C3_STATE,
+  D_DMA_READS_ALL, D_DMA_WRITES_ALL, D_DMA_READS_TO_DCCM, D_DMA_WRITESS_TO_DCCM,
+#endif /* D_SWERV_EL2 */
+};
+
+/**
+* APIs
+*/
+
+/**
+* @brief - Read the low 32 bits of the event counters
+*
+* @parameter - pCounts - output - D_PSP_PMU_MUX_GROUP_SIZE values
+* @return    - none
+*/
+D_PSP_ALWAYS_INLINE void pspPmuMuxReadCounters(u32_t* pCounts)
+{
+  pCounts[0] = M_PSP_READ_CSR(D_PSP_MHPMCOUNTER3_NUM);
+  pCounts[1] = M_PSP_READ_CSR(D_PSP_MHPMCOUNTER4_NUM);
+  pCounts[2] = M_PSP_READ_CSR(D_PSP_MHPMCOUNTER5_NUM);
+  pCounts[3] = M_PSP_READ_CSR(D_PSP_MHPMCOUNTER6_NUM);
+}
+
+/**
+* @brief - Program the events of the current group on the counters and take the
+*          start values. The unused counters of the last group count nothing
+*
+* @parameter - pMux - the multiplexer
+* @return    - none
+*/
+D_PSP_ALWAYS_INLINE void pspPmuMuxProgramGroup(pspPmuMux_t* pMux)
+{
+  u32_t uiSlot, uiEventIndex;
+  u32_t uiEvent;
+
+  for (uiSlot = 0; uiSlot < D_PSP_PMU_MUX_GROUP_SIZE; uiSlot++)
+  {
+    uiEventIndex = pMux->uiGroup * D_PSP_PMU_MUX_GROUP_SIZE + uiSlot;
+    uiEvent = (uiEventIndex < pMux->uiNumOfEvents) ? pMux->uiEvent[uiEventIndex] : D_PSP_PMU_MUX_NO_EVENT;
+    pspMachinePerfCounterSet(D_PSP_COUNTER0 << uiSlot, uiEvent);
+  }
+
+  pspPmuMuxReadCounters(pMux->uiGroupStartCount);
+  pMux->uiGroupStartCycle = M_PSP_READ_CSR(D_PSP_MCYCLE_NUM);
+}
+
+/**
+* @brief - Accumulate the counts of the current group and the cycles it was on the counters
+*
+* @parameter - pMux - the multiplexer
+* @return    - none
+*/
+D_PSP_ALWAYS_INLINE void pspPmuMuxAccumulate(pspPmuMux_t* pMux)
+{
+  u32_t uiCounts[D_PSP_PMU_MUX_GROUP_SIZE];
+  u32_t uiCycles = M_PSP_READ_CSR(D_PSP_MCYCLE_NUM) - pMux->uiGroupStartCycle;
+  u32_t uiSlot, uiEventIndex;
+
+  pspPmuMuxReadCounters(uiCounts);
+
+  for (uiSlot = 0; uiSlot < D_PSP_PMU_MUX_GROUP_SIZE; uiSlot++)
+  {
+    uiEventIndex = pMux->uiGroup * D_PSP_PMU_MUX_GROUP_SIZE + uiSlot;
+    if (uiEventIndex < pMux->uiNumOfEvents)
+    {
+      pMux->udCount[uiEventIndex] += uiCounts[uiSlot] - pMux->uiGroupStartCount[uiSlot];
+    }
+  }
+
+  pMux->udEnabledCycles[pMux->uiGroup] += uiCycles;
+  pMux->udTotalCycles += uiCycles;
+}
+
+/**
+* @brief - Scale a count to the whole run - count * total / enabled. Both cycle counts
+*          are shifted right by the same amount until the total fits in 32 bits, so the
+*          remainder product fits in 64 bits on a run of any length
+*
+* @parameter - udCount   - count of the event
+* @parameter - udEnabled - cycles the event was on the counters, not 0
+* @parameter - udTotal   - cycles of the whole run, not below udEnabled
+* @return    - the scaled count
+*/
+D_PSP_ALWAYS_INLINE u64_t pspPmuMuxScale(u64_t udCount, u64_t udEnabled, u64_t udTotal)
+{
+  while (udTotal > D_PSP_32BIT_MASK)
+  {
+    udTotal >>= 1;
+    udEnabled >>= 1;
+  }
+
+  /* Only when the event was on the counters for less than 2^-32 of the run */
+  if (0 == udEnabled)
+  {
+    udEnabled = 1;
+  }
+
+  return (udCount / udEnabled) * udTotal + ((udCount % udEnabled) * udTotal) / udEnabled;
+}
+
+/**
+* @brief - Set the events to multiplex and clear their counts
+*
+* @parameter - pEvents       - events (D_CYCLES_CLOCKS_ACTIVE etc.). NULL - all the events of the core
+* @parameter - uiNumOfEvents - number of events, up to D_PSP_PMU_MUX_MAX_EVENTS. Ignored when pEvents is NULL
+* @return    - number of multiplexed events
+*/
+D_PSP_TEXT_SECTION u32_t pspPmuMuxInit(const u32_t* pEvents, u32_t uiNumOfEvents)
+{
+  static const pspPmuMux_t stZeroMux = { 0 };
+  pspPmuMux_t* pMux = &g_stPspPmuMux;
+  u32_t uiEventIndex;
+
+  if (NULL == pEvents)
+  {
+    pEvents = g_uiPspPmuMuxAllEvents;
+    uiNumOfEvents = sizeof(g_uiPspPmuMuxAllEvents) / sizeof(g_uiPspPmuMuxAllEvents[0]);
+  }
+
+  M_PSP_ASSERT((0 != uiNumOfEvents) && (D_PSP_PMU_MUX_MAX_EVENTS >= uiNumOfEvents));
+
+  *pMux = stZeroMux;
+  for (uiEventIndex = 0; uiEventIndex < uiNumOfEvents; uiEventIndex++)
+  {
+    pMux->uiEvent[uiEventIndex] = pEvents[uiEventIndex];
+  }
+  pMux->uiNumOfEvents = uiNumOfEvents;
+  pMux->uiNumOfGroups = (uiNumOfEvents + D_PSP_PMU_MUX_GROUP_SIZE - 1) / D_PSP_PMU_MUX_GROUP_SIZE;
+
+  return uiNumOfEvents;
+}
+
+/**
+* @brief - Internal timer interrupt handler - rotate the groups
+*
+* @parameter - none
+* @return    - none
+*/
+D_PSP_TEXT_SECTION void pspPmuMuxTimerIsr(void)
+{
+  pspPmuMuxRotate();
+}
+
+/**
+* @brief - Put the first group on the counters and start rotating the groups on an
+*          internal timer tick. The machine interrupts must be enabled by the caller
+*
+* @parameter - uiTimer        - D_PSP_INTERNAL_TIMER0 or D_PSP_INTERNAL_TIMER1
+* @parameter - uiPeriodCycles - rotation period in cycles. Should be well below 2^31, so
+*                               an event count does not wrap within a period
+* @return    - none
+*/
+D_PSP_TEXT_SECTION void pspPmuMuxStart(u32_t uiTimer, u32_t uiPeriodCycles)
+{
+  pspPmuMux_t* pMux = &g_stPspPmuMux;
+  u32_t uiInterruptsState;
+
+  M_PSP_ASSERT(((D_PSP_INTERNAL_TIMER0 == uiTimer) || (D_PSP_INTERNAL_TIMER1 == uiTimer)) && (0 != pMux->uiNumOfGroups));
+
+  pspMachineInterruptsDisable(&uiInterruptsState);
+
+  pMux->uiTimer = uiTimer;
+  pMux->uiGroup = 0;
+  pspMachinePerfMonitorEnableAll();
+  pspPmuMuxProgramGroup(pMux);
+
+  if (D_PSP_INTERNAL_TIMER0 == uiTimer)
+  {
+    pspMachineInterruptsRegisterIsr(pspPmuMuxTimerIsr, E_MACHINE_INTERNAL_TIMER0_CAUSE);
+    pspMachineInterruptsEnableIntNumber(D_PSP_INTERRUPTS_MACHINE_INTERNAL_TIMER0);
+  }
+  else
+  {
+    pspMachineInterruptsRegisterIsr(pspPmuMuxTimerIsr, E_MACHINE_INTERNAL_TIMER1_CAUSE);
+    pspMachineInterruptsEnableIntNumber(D_PSP_INTERRUPTS_MACHINE_INTERNAL_TIMER1);
+  }
+  /* The internal timer restarts from 0 when it reaches the period */
+  pspMachineInternalTimerCounterSetup(uiTimer, uiPeriodCycles);
+  pspMachineInternalTimerRun(uiTimer);
+
+  pspMachineInterruptsRestore(uiInterruptsState);
+}
+
+/**
+* @brief - Accumulate the counts of the group on the counters and put the next group on
+*          them. Called from the internal timer interrupt; can also be called from another
+*          periodic tick with interrupts disabled
+*
+* @parameter - none
+* @return    - none
+*/
+D_PSP_TEXT_SECTION void pspPmuMuxRotate(void)
+{
+  pspPmuMux_t* pMux = &g_stPspPmuMux;
+
+  pspPmuMuxAccumulate(pMux);
+
+  pMux->uiGroup++;
+  if (pMux->uiGroup == pMux->uiNumOfGroups)
+  {
+    pMux->uiGroup = 0;
+  }
+  pMux->uiNumOfRotations++;
+
+  pspPmuMuxProgramGroup(pMux);
+}
+
+/**
+* @brief - Stop rotating and accumulate the counts of the group on the counters
+*
+* @parameter - none
+* @return    - none
+*/
+D_PSP_TEXT_SECTION void pspPmuMuxStop(void)
+{
+  pspPmuMux_t* pMux = &g_stPspPmuMux;
+  u32_t uiInterruptsState;
+
+  pspMachineInterruptsDisable(&uiInterruptsState);
+
+  pspMachineInternalTimerPause(pMux->uiTimer);
+  if (D_PSP_INTERNAL_TIMER0 == pMux->uiTimer)
+  {
+    pspMachineInterruptsDisableIntNumber(D_PSP_INTERRUPTS_MACHINE_INTERNAL_TIMER0);
+  }
+  else
+  {
+    pspMachineInterruptsDisableIntNumber(D_PSP_INTERRUPTS_MACHINE_INTERNAL_TIMER1);
+  }
+
+  pspPmuMuxAccumulate(pMux);
+
+  pspMachineInterruptsRestore(uiInterruptsState);
+}
+
+/**
+* @brief - Get the results of the events
+*
+* @parameter - pResults       - output - uiMaxResults results, in the order of the events
+* @parameter - uiMaxResults   - number of entries in pResults
+* @parameter - pTotalCycles   - output - cycles of the whole run
+* @return    - number of results
+*/
+D_PSP_TEXT_SECTION u32_t pspPmuMuxGetResults(pspPmuMuxResult_t* pResults, u32_t uiMaxResults, u64_t* pTotalCycles)
+{
+  pspPmuMux_t* pMux = &g_stPspPmuMux;
+  u32_t uiEventIndex;
+  u64_t udEnabled, udCount;
+
+  M_PSP_ASSERT((NULL != pResults) && (NULL != pTotalCycles));
+
+  if (uiMaxResults > pMux->uiNumOfEvents)
+  {
+    uiMaxResults = pMux->uiNumOfEvents;
+  }
+
+  for (uiEventIndex = 0; uiEventIndex < uiMaxResults; uiEventIndex++)
+  {
+    udCount = pMux->udCount[uiEventIndex];
+    udEnabled = pMux->udEnabledCycles[uiEventIndex / D_PSP_PMU_MUX_GROUP_SIZE];
+
+    pResults[uiEventIndex].uiEvent = pMux->uiEvent[uiEventIndex];
+    pResults[uiEventIndex].udCount = udCount;
+    pResults[uiEventIndex].udEnabledCycles = udEnabled;
+    pResults[uiEventIndex].udScaledCount = (0 == udEnabled) ? 0 : pspPmuMuxScale(udCount, udEnabled, pMux->udTotalCycles);
+  }
+
+  *pTotalCycles = pMux->udTotalCycles;
+
+  return uiMaxResults;
+}
@@ -0,0 +1,249 @@
+/*
+* SPDX-License-Identifier: Apache-2.0
+* Copyright 2026 Western Digital Corporation or its affiliates.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http:*www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+/**
+* @file   psp_profile_eh1.c
+* @author Western Digital
+* @date   16.10.2026
+* @brief  The file supplies region profiling on the SweRV performance counters. Each
+*         hart keeps a stack of the regions in progress with the counter values at
+*         their start; when a region ends the counter deltas are accumulated into the
+*         statistics of its region-id. Only the low 32 bits of the counters are read -
+*         a single region is measured up to 2^32 counts
+*/
+
+/**
+* include files
+*/
+#include "psp_api.h"
+
+#ifdef D_PSP_PROFILE
+
+/**
+* definitions
+*/
+
+/**
+* macros
+*/
+#ifdef D_SWERV_EH2
+  #define M_PSP_PROFILE_HART_ID()    M_PSP_MACHINE_GET_HART_ID()
+#else
+  #define M_PSP_PROFILE_HART_ID()    0
+#endif
+
+/**
+* types
+*/
+
+/**
+* local prototypes
+*/
+
+/**
+* external prototypes
+*/
+
+/**
+* global variables
+*/
+/* Regions in progress */
+D_PSP_DCCM_DATA_SECTION pspProfileStack_t g_stPspProfileStack[D_PSP_NUM_OF_HARTS];
+
+/* Statistics per region-id. Can be read by the debugger */
+D_PSP_DCCM_DATA_SECTION pspProfileStats_t g_stPspProfileStats[D_PSP_NUM_OF_HARTS][D_PSP_PROFILE_NUM_OF_IDS];
+
+/**
+* APIs
+*/
+
+/**
+* @brief - Read the low 32 bits of the measured counters
+*
+* @parameter - pCounters - output - D_PSP_PROFILE_NUM_OF_COUNTERS values
+* @return    - none
+*/
+D_PSP_ALWAYS_INLINE void pspProfileReadCounters(u32_t* pCounters)
+{
+  pCounters[D_PSP_PROFILE_CYCLES]  = M_PSP_READ_CSR(D_PSP_MCYCLE_NUM);
+  pCounters[D_PSP_PROFILE_INSTRET] = M_PSP_READ_CSR(D_PSP_MINSTRET_NUM);
+  pCounters[D_PSP_PROFILE_EVENT0]  = M_PSP_READ_CSR(D_PSP_MHPMCOUNTER3_NUM);
+  pCounters[D_PSP_PROFILE_EVENT1]  = M_PSP_READ_CSR(D_PSP_MHPMCOUNTER4_NUM);
+  pCounters[D_PSP_PROFILE_EVENT2]  = M_PSP_READ_CSR(D_PSP_MHPMCOUNTER5_NUM);
+  pCounters[D_PSP_PROFILE_EVENT3]  = M_PSP_READ_CSR(D_PSP_MHPMCOUNTER6_NUM);
+}
+
+/**
+* @brief - Accumulate a counter delta into the measure statistics
+*
+* @parameter - pMeasure - measure to update
+* @parameter - uiDelta  - counter delta of the region
+* @parameter - uiCount  - number of runs already accumulated
+* @return    - none
+*/
+D_PSP_ALWAYS_INLINE void pspProfileMeasureUpdate(pspProfileMeasure_t* pMeasure, u32_t uiDelta, u32_t uiCount)
+{
+  if (0 == uiCount || uiDelta < pMeasure->uiMin)
+  {
+    pMeasure->uiMin = uiDelta;
+  }
+  if (uiDelta > pMeasure->uiMax)
+  {
+    pMeasure->uiMax = uiDelta;
+  }
+  pMeasure->udTotal += uiDelta;
+}
+
+/**
+* @brief - Clear the profiling statistics of the current hart
+*
+* @parameter - none
+* @return    - none
+*/
+D_PSP_TEXT_SECTION void pspProfileReset(void)
+{
+  static const pspProfileStats_t stZeroStats = { 0 };
+  u32_t uiInterruptsState, uiId;
+  u32_t uiHartNumber = M_PSP_PROFILE_HART_ID();
+
+  pspMachineInterruptsDisable(&uiInterruptsState);
+
+  g_stPspProfileStack[uiHartNumber].uiDepth = 0;
+  g_stPspProfileStack[uiHartNumber].uiNumOfSkipped = 0;
+  for (uiId = 0 ; uiId < D_PSP_PROFILE_NUM_OF_IDS ; uiId++)
+  {
+    g_stPspProfileStats[uiHartNumber][uiId] = stZeroStats;
+  }
+
+  pspMachineInterruptsRestore(uiInterruptsState);
+}
+
+/**
+* @brief - Program the events of the four event counters, start the counters and clear
+*          the profiling statistics of the current hart
+*
+* @parameter - uiEvent0..3 - events (D_CYCLES_CLOCKS_ACTIVE etc.) of D_PSP_COUNTER0..3
+* @return    - none
+*/
+D_PSP_TEXT_SECTION void pspProfileInit(u32_t uiEvent0, u32_t uiEvent1, u32_t uiEvent2, u32_t uiEvent3)
+{
+  pspMachinePerfCounterSet(D_PSP_COUNTER0, uiEvent0);
+  pspMachinePerfCounterSet(D_PSP_COUNTER1, uiEvent1);
+  pspMachinePerfCounterSet(D_PSP_COUNTER2, uiEvent2);
+  pspMachinePerfCounterSet(D_PSP_COUNTER3, uiEvent3);
+  pspMachinePerfMonitorEnableAll();
+
+  pspProfileReset();
+}
+
+/**
+* @brief - Start a region
+*
+* @parameter - uiId - region-id, less than D_PSP_PROFILE_NUM_OF_IDS
+* @return    - none
+*/
+D_PSP_TEXT_SECTION void pspProfileBegin(u32_t uiId)
+{
+  u32_t uiInterruptsState;
+  pspProfileStack_t* pStack = &g_stPspProfileStack[M_PSP_PROFILE_HART_ID()];
+  pspProfileFrame_t* pFrame;
+
+  M_PSP_ASSERT(D_PSP_PROFILE_NUM_OF_IDS > uiId);
+
+  /* The stack is shared with the regions of the interrupt handlers */
+  pspMachineInterruptsDisable(&uiInterruptsState);
+
+  if (D_PSP_PROFILE_MAX_DEPTH > pStack->uiDepth)
+  {
+    pFrame = &pStack->stFrame[pStack->uiDepth];
+    pStack->uiDepth++;
+    pFrame->uiId = uiId;
+    /* Read the counters last, so the bookkeeping is not measured */
+    pspProfileReadCounters(pFrame->uiStart);
+  }
+  else
+  {
+    pStack->uiNumOfSkipped++;
+  }
+
+  pspMachineInterruptsRestore(uiInterruptsState);
+}
+
+/**
+* @brief - End the innermost region and accumulate its counters
+*
+* @parameter - uiId - region-id. Must be the id of the innermost region
+* @return    - none
+*/
+D_PSP_TEXT_SECTION void pspProfileEnd(u32_t uiId)
+{
+  u32_t uiEnd[D_PSP_PROFILE_NUM_OF_COUNTERS];
+  u32_t uiInterruptsState, uiCounter;
+  u32_t uiHartNumber = M_PSP_PROFILE_HART_ID();
+  pspProfileStack_t* pStack = &g_stPspProfileStack[uiHartNumber];
+  pspProfileFrame_t* pFrame;
+  pspProfileStats_t* pStats;
+
+  /* Read the counters first, so the bookkeeping is not measured */
+  pspProfileReadCounters(uiEnd);
+
+  pspMachineInterruptsDisable(&uiInterruptsState);
+
+  if (0 != pStack->uiNumOfSkipped)
+  {
+    /* The region was too deep to be measured */
+    pStack->uiNumOfSkipped--;
+  }
+  else
+  {
+    M_PSP_ASSERT(0 != pStack->uiDepth);
+    pStack->uiDepth--;
+    pFrame = &pStack->stFrame[pStack->uiDepth];
+    M_PSP_ASSERT(uiId == pFrame->uiId);
+
+    pStats = &g_stPspProfileStats[uiHartNumber][pFrame->uiId];
+    for (uiCounter = 0 ; uiCounter < D_PSP_PROFILE_NUM_OF_COUNTERS ; uiCounter++)
+    {
+      pspProfileMeasureUpdate(&pStats->stCounter[uiCounter], uiEnd[uiCounter] - pFrame->uiStart[uiCounter], pStats->uiCount);
+    }
+    pStats->uiCount++;
+  }
+
+  pspMachineInterruptsRestore(uiInterruptsState);
+}
+
+/**
+* @brief - Get the profiling statistics of a region-id on the current hart
+*
+* @parameter - uiId   - region-id
+* @parameter - pStats - output - copy of the statistics
+* @return    - u32_t  - number of measured runs of the region
+*/
+D_PSP_TEXT_SECTION u32_t pspProfileGetStats(u32_t uiId, pspProfileStats_t* pStats)
+{
+  u32_t uiInterruptsState;
+
+  M_PSP_ASSERT(NULL != pStats && D_PSP_PROFILE_NUM_OF_IDS > uiId);
+
+  /* Take a consistent copy - the statistics are updated from interrupt context */
+  pspMachineInterruptsDisable(&uiInterruptsState);
+  *pStats = g_stPspProfileStats[M_PSP_PROFILE_HART_ID()][uiId];
+  pspMachineInterruptsRestore(uiInterruptsState);
+
+  return pStats->uiCount;
+}
+
+#endif /* D_PSP_PROFILE */
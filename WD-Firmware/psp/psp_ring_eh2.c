@@ -0,0 +1,239 @@
+/*
+* SPDX-License-Identifier: Apache-2.0
+* Copyright 2026 Western Digital Corporation or its affiliates.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http:*www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+/**
+* @file   psp_ring_eh2.c
+* @author Western Digital
+* @date   16.10.2026
+* @brief  The file supplies lock-free ring buffers for passing words between harts
+*         on SweRV EH2. An item is published with a release fence before the index
+*         (or the slot sequence) is updated, and is read after an acquire fence
+*/
+
+/**
+* include files
+*/
+#include "psp_api.h"
+
+/**
+* types
+*/
+
+/**
+* definitions
+*/
+
+/**
+* local prototypes
+*/
+
+/**
+* external prototypes
+*/
+
+/**
+* macros
+*/
+#define M_PSP_RING_IS_POWER_OF_2(uiSize)   ((0 != (uiSize)) && (0 == ((uiSize) & ((uiSize) - 1))))
+
+/**
+* global variables
+*/
+
+/**
+* APIs
+*/
+
+/**
+* @brief - Initialize a single producer single consumer ring
+*
+* @parameter - pRing    - the ring
+* @parameter - pBuffer  - buffer of the ring
+* @parameter - uiSize   - number of words in the buffer. Must be a power of 2
+*
+* @return    - none
+*/
+D_PSP_TEXT_SECTION void pspRingSpscInit(pspRingSpsc_t* pRing, u32_t* pBuffer, u32_t uiSize)
+{
+  M_PSP_ASSERT((NULL != pRing) && (NULL != pBuffer) && M_PSP_RING_IS_POWER_OF_2(uiSize));
+
+  pRing->uiHead  = 0;
+  pRing->uiTail  = 0;
+  pRing->pBuffer = pBuffer;
+  pRing->uiMask  = uiSize - 1;
+}
+
+/**
+* @brief - Put a word in a single producer single consumer ring. Called by the producer only
+*
+* @parameter - pRing    - the ring
+* @parameter - uiItem   - word to put
+*
+* @return    - D_PSP_SUCCESS, D_PSP_FAIL - the ring is full
+*/
+D_PSP_TEXT_SECTION u32_t pspRingSpscPush(pspRingSpsc_t* pRing, u32_t uiItem)
+{
+  u32_t uiHead = pRing->uiHead;
+
+  if ((uiHead - pRing->uiTail) > pRing->uiMask)
+  {
+    return D_PSP_FAIL;
+  }
+
+  pRing->pBuffer[uiHead & pRing->uiMask] = uiItem;
+
+  /* Release - the item is written before it is published to the consumer */
+  M_PSP_ATOMICS_FENCE_RELEASE();
+  pRing->uiHead = uiHead + 1;
+
+  return D_PSP_SUCCESS;
+}
+
+/**
+* @brief - Take a word from a single producer single consumer ring. Called by the consumer only
+*
+* @parameter - pRing    - the ring
+* @parameter - pItem    - output - the word taken
+*
+* @return    - D_PSP_SUCCESS, D_PSP_FAIL - the ring is empty
+*/
+D_PSP_TEXT_SECTION u32_t pspRingSpscPop(pspRingSpsc_t* pRing, u32_t* pItem)
+{
+  u32_t uiTail = pRing->uiTail;
+
+  if (uiTail == pRing->uiHead)
+  {
+    return D_PSP_FAIL;
+  }
+
+  /* Acquire - the item is not read before it is published */
+  M_PSP_ATOMICS_FENCE_ACQUIRE();
+  *pItem = pRing->pBuffer[uiTail & pRing->uiMask];
+
+  /* Release - the item is read before the producer may reuse its entry */
+  M_PSP_ATOMICS_FENCE_RELEASE();
+  pRing->uiTail = uiTail + 1;
+
+  return D_PSP_SUCCESS;
+}
+
+/**
+* @brief - Initialize a multiple producers single consumer ring
+*
+* @parameter - pRing    - the ring
+* @parameter - pSlots   - slots of the ring
+* @parameter - uiSize   - number of slots. Must be a power of 2
+*
+* @return    - none
+*/
+D_PSP_TEXT_SECTION void pspRingMpscInit(pspRingMpsc_t* pRing, pspRingSlot_t* pSlots, u32_t uiSize)
+{
+  u32_t uiIndex;
+
+  M_PSP_ASSERT((NULL != pRing) && (NULL != pSlots) && M_PSP_RING_IS_POWER_OF_2(uiSize));
+
+  /* Each slot is free for the producer of its index */
+  for (uiIndex = 0; uiIndex < uiSize; uiIndex++)
+  {
+    pSlots[uiIndex].uiSequence = uiIndex;
+  }
+
+  pRing->uiHead = 0;
+  pRing->uiTail = 0;
+  pRing->pSlots = pSlots;
+  pRing->uiMask = uiSize - 1;
+}
+
+/**
+* @brief - Put a word in a multiple producers single consumer ring. Can be called by any hart
+*
+* @parameter - pRing    - the ring
+* @parameter - uiItem   - word to put
+*
+* @return    - D_PSP_SUCCESS, D_PSP_FAIL - the ring is full
+*/
+D_PSP_TEXT_SECTION u32_t pspRingMpscPush(pspRingMpsc_t* pRing, u32_t uiItem)
+{
+  pspRingSlot_t* pSlot;
+  u32_t uiHead = pRing->uiHead;
+  u32_t uiPrevHead;
+  s32_t siDiff;
+
+  while (1)
+  {
+    pSlot = &pRing->pSlots[uiHead & pRing->uiMask];
+    siDiff = (s32_t)(pSlot->uiSequence - uiHead);
+    if (0 == siDiff)
+    {
+      /* The slot is free - reserve its index. Another producer may have reserved it first */
+      uiPrevHead = pspAtomicsInlineCompareAndSwap((u32_t*)&pRing->uiHead, uiHead, uiHead + 1);
+      if (uiPrevHead == uiHead)
+      {
+        break;
+      }
+      uiHead = uiPrevHead;
+    }
+    else if (0 > siDiff)
+    {
+      /* The slot still holds an item from the previous round - the ring is full */
+      return D_PSP_FAIL;
+    }
+    else
+    {
+      /* Another producer reserved this index - retry with the current one */
+      uiHead = pRing->uiHead;
+    }
+  }
+
+  pSlot->uiItem = uiItem;
+
+  /* Release - the item is written before it is published to the consumer */
+  M_PSP_ATOMICS_FENCE_RELEASE();
+  pSlot->uiSequence = uiHead + 1;
+
+  return D_PSP_SUCCESS;
+}
+
+/**
+* @brief - Take a word from a multiple producers single consumer ring. Called by the consumer only
+*
+* @parameter - pRing    - the ring
+* @parameter - pItem    - output - the word taken
+*
+* @return    - D_PSP_SUCCESS, D_PSP_FAIL - the ring is empty
+*/
+D_PSP_TEXT_SECTION u32_t pspRingMpscPop(pspRingMpsc_t* pRing, u32_t* pItem)
+{
+  u32_t uiTail = pRing->uiTail;
+  pspRingSlot_t* pSlot = &pRing->pSlots[uiTail & pRing->uiMask];
+
+  /* The slot is empty, or a producer reserved it but did not publish the item yet */
+  if ((uiTail + 1) != pSlot->uiSequence)
+  {
+    return D_PSP_FAIL;
+  }
+
+  /* Acquire - the item is not read before it is published */
+  M_PSP_ATOMICS_FENCE_ACQUIRE();
+  *pItem = pSlot->uiItem;
+
+  /* Release - the item is read before the slot is freed for the next round */
+  M_PSP_ATOMICS_FENCE_RELEASE();
+  pSlot->uiSequence = uiTail + pRing->uiMask + 1;
+  pRing->uiTail = uiTail + 1;
+
+  return D_PSP_SUCCESS;
+}
@@ -0,0 +1,442 @@
+/*
+* SPDX-License-Identifier: Apache-2.0
+* Copyright 2026 Western Digital Corporation or its affiliates.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http:*www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+/**
+* @file   psp_timer_wheel_eh1.c
+* @author Western Digital
+* @date   16.10.2026
+* @brief  The file supplies the high-resolution timer service of SweRV cores.
+*         A timer is kept in the level of the wheel where its expiration tick first differs
+*         from the current tick, in the slot of that 5-bit digit. Level 0 slots expire, and
+*         the slots of the higher levels are moved down the wheel (cascaded) when the
+*         current tick reaches them. The next tick of any of them is found from the slots
+*         bitmaps, so the wheel is processed only at the ticks where something happens
+*/
+
+/**
+* include files
+*/
+#include "psp_api.h"
+
+/**
+* definitions
+*/
+#define D_PSP_TIMER_WHEEL_TICK_CYCLES      (1ULL << D_PSP_TIMER_WHEEL_TICK_SHIFT)
+/* Ticks covered by the levels */
+#define D_PSP_TIMER_WHEEL_LEVELS_BITS      (D_PSP_TIMER_WHEEL_LEVELS * D_PSP_TIMER_WHEEL_SLOT_BITS)
+/* Nothing to process on the wheel */
+#define D_PSP_TIMER_WHEEL_NO_TICK          0xFFFFFFFFFFFFFFFFULL
+/* Longest period of the internal timer */
+#define D_PSP_TIMER_WHEEL_MAX_ARM_CYCLES   0xFFFFFFFF
+#define D_PSP_TIMER_WHEEL_ALL_SLOTS        0xFFFFFFFF
+
+/**
+* macros
+*/
+#ifdef D_SWERV_EH2
+  #define M_PSP_TIMER_WHEEL_HART_ID()    M_PSP_MACHINE_GET_HART_ID()
+#else
+  #define M_PSP_TIMER_WHEEL_HART_ID()    0
+#endif
+
+#define M_PSP_TIMER_WHEEL_CYCLES()       M_PSP_READ_CSR64(D_PSP_MCYCLE_NUM, D_PSP_MCYCLEH_NUM)
+
+/* List of a slot of a level */
+#define M_PSP_TIMER_WHEEL_LIST(uiLevel, uiSlot)   (D_PSP_TIMER_WHEEL_FIRST_LIST + (uiLevel) * D_PSP_TIMER_WHEEL_SLOTS + (uiSlot))
+
+/* The 5-bit digit of a tick in a level */
+#define M_PSP_TIMER_WHEEL_DIGIT(udTick, uiLevel)  ((u32_t)((udTick) >> ((uiLevel) * D_PSP_TIMER_WHEEL_SLOT_BITS)) & (D_PSP_TIMER_WHEEL_SLOTS - 1))
+
+/**
+* types
+*/
+
+/**
+* local prototypes
+*/
+D_PSP_TEXT_SECTION void pspTimerWheelInsert(pspTimerWheel_t* pWheel, pspTimerWheelTimer_t* pTimer);
+D_PSP_TEXT_SECTION void pspTimerWheelRemove(pspTimerWheel_t* pWheel, pspTimerWheelTimer_t* pTimer);
+D_PSP_TEXT_SECTION u64_t pspTimerWheelNextTick(pspTimerWheel_t* pWheel);
+D_PSP_TEXT_SECTION void pspTimerWheelArm(pspTimerWheel_t* pWheel, u64_t udTick);
+D_PSP_TEXT_SECTION void pspTimerWheelCascade(pspTimerWheel_t* pWheel, u32_t uiList);
+
+/**
+* external prototypes
+*/
+
+/**
+* global variables
+*/
+/* Timing wheel per hart */
+D_PSP_DCCM_DATA_SECTION pspTimerWheel_t g_stPspTimerWheel[D_PSP_NUM_OF_HARTS];
+
+/**
+* APIs
+*/
+
+/**
+* @brief - Put a timer on the wheel, by its expiration tick. A tick that already passed is
+*          put in the current slot, so it expires on the next processing of the wheel
+*
+* @parameter - pWheel - the wheel of the hart
+* @parameter - pTimer - the timer
+* @return    - none
+*/
+D_PSP_TEXT_SECTION void pspTimerWheelInsert(pspTimerWheel_t* pWheel, pspTimerWheelTimer_t* pTimer)
+{
+  u64_t udTick = (pTimer->udExpiryCycles + D_PSP_TIMER_WHEEL_TICK_CYCLES - 1) >> D_PSP_TIMER_WHEEL_TICK_SHIFT;
+  u64_t udDiff;
+  u32_t uiLevel = 0, uiList;
+
+  if (udTick < pWheel->udTick)
+  {
+    udTick = pWheel->udTick;
+  }
+
+  /* The highest digit that differs from the current tick selects the level */
+  udDiff = udTick ^ pWheel->udTick;
+  if (0 != (udDiff >> D_PSP_TIMER_WHEEL_LEVELS_BITS))
+  {
+    uiList = D_PSP_TIMER_WHEEL_OVERFLOW_LIST;
+  }
+  else
+  {
+    if (0 != udDiff)
+    {
+      uiLevel = (D_PSP_BITMANIP_WORD_BITS - 1 - pspBitmanipClz((u32_t)udDiff)) / D_PSP_TIMER_WHEEL_SLOT_BITS;
+    }
+    uiList = M_PSP_TIMER_WHEEL_LIST(uiLevel, M_PSP_TIMER_WHEEL_DIGIT(udTick, uiLevel));
+    pWheel->uiSlotsBitmap[uiLevel] = pspBitmanipBitSet(pWheel->uiSlotsBitmap[uiLevel], M_PSP_TIMER_WHEEL_DIGIT(udTick, uiLevel));
+  }
+
+  pTimer->uiList = uiList;
+  pTimer->pPrev = NULL;
+  pTimer->pNext = pWheel->pList[uiList];
+  if (NULL != pTimer->pNext)
+  {
+    pTimer->pNext->pPrev = pTimer;
+  }
+  pWheel->pList[uiList] = pTimer;
+}
+
+/**
+* @brief - Take a timer off the wheel
+*
+* @parameter - pWheel - the wheel of the hart
+* @parameter - pTimer - the timer
+* @return    - none
+*/
+D_PSP_TEXT_SECTION void pspTimerWheelRemove(pspTimerWheel_t* pWheel, pspTimerWheelTimer_t* pTimer)
+{
+  u32_t uiList = pTimer->uiList;
+  u32_t uiLevel;
+
+  if (NULL != pTimer->pNext)
+  {
+    pTimer->pNext->pPrev = pTimer->pPrev;
+  }
+  if (NULL != pTimer->pPrev)
+  {
+    pTimer->pPrev->pNext = pTimer->pNext;
+  }
+  else
+  {
+    pWheel->pList[uiList] = pTimer->pNext;
+    /* The slot is empty now */
+    if ((NULL == pTimer->pNext) && (D_PSP_TIMER_WHEEL_OVERFLOW_LIST != uiList))
+    {
+      uiLevel = (uiList - D_PSP_TIMER_WHEEL_FIRST_LIST) / D_PSP_TIMER_WHEEL_SLOTS;
+      pWheel->uiSlotsBitmap[uiLevel] = pspBitmanipBitClear(pWheel->uiSlotsBitmap[uiLevel],
+                                                           (uiList - D_PSP_TIMER_WHEEL_FIRST_LIST) % D_PSP_TIMER_WHEEL_SLOTS);
+    }
+  }
+
+  pTimer->uiList = D_PSP_TIMER_WHEEL_NOT_ACTIVE;
+}
+
+/**
+* @brief - Next tick to process: the tick of the first non-empty slot after the current tick
+*          in the lowest level that has one. The slots of a level come after all the ticks
+*          of the levels below it
+*
+* @parameter - pWheel - the wheel of the hart
+* @return    - the tick, D_PSP_TIMER_WHEEL_NO_TICK when the wheel is empty
+*/
+D_PSP_TEXT_SECTION u64_t pspTimerWheelNextTick(pspTimerWheel_t* pWheel)
+{
+  u64_t udTick = pWheel->udTick;
+  u32_t uiLevel, uiShift, uiDigit, uiSlots;
+
+  for (uiLevel = 0; uiLevel < D_PSP_TIMER_WHEEL_LEVELS; uiLevel++)
+  {
+    uiShift = uiLevel * D_PSP_TIMER_WHEEL_SLOT_BITS;
+    uiDigit = M_PSP_TIMER_WHEEL_DIGIT(udTick, uiLevel);
+    /* The current slot of level 0 holds the expired timers. The higher levels only have
+       later slots - their current slot was cascaded when the tick reached it */
+    uiSlots = pWheel->uiSlotsBitmap[uiLevel] & (D_PSP_TIMER_WHEEL_ALL_SLOTS << uiDigit);
+    if (0 != uiLevel)
+    {
+      uiSlots = pspBitmanipBitClear(uiSlots, uiDigit);
+    }
+    if (0 != uiSlots)
+    {
+      return (((udTick >> (uiShift + D_PSP_TIMER_WHEEL_SLOT_BITS)) << (uiShift + D_PSP_TIMER_WHEEL_SLOT_BITS)) |
+              ((u64_t)pspBitmanipCtz(uiSlots) << uiShift));
+    }
+  }
+
+  /* The overflow list is sorted out when the levels wrap */
+  if (NULL != pWheel->pList[D_PSP_TIMER_WHEEL_OVERFLOW_LIST])
+  {
+    return ((udTick >> D_PSP_TIMER_WHEEL_LEVELS_BITS) + 1) << D_PSP_TIMER_WHEEL_LEVELS_BITS;
+  }
+
+  return D_PSP_TIMER_WHEEL_NO_TICK;
+}
+
+/**
+* @brief - Set the internal timer to interrupt on a tick
+*
+* @parameter - pWheel - the wheel of the hart
+* @parameter - udTick - the tick. D_PSP_TIMER_WHEEL_NO_TICK - the longest period
+* @return    - none
+*/
+D_PSP_TEXT_SECTION void pspTimerWheelArm(pspTimerWheel_t* pWheel, u64_t udTick)
+{
+  u64_t udCycles = D_PSP_TIMER_WHEEL_MAX_ARM_CYCLES;
+  u64_t udNow;
+
+  pWheel->udArmedTick = udTick;
+
+  if (D_PSP_TIMER_WHEEL_NO_TICK != udTick)
+  {
+    udNow = M_PSP_TIMER_WHEEL_CYCLES();
+    udTick <<= D_PSP_TIMER_WHEEL_TICK_SHIFT;
+    if (udTick <= udNow)
+    {
+      udCycles = 1;
+    }
+    else if (udTick - udNow < D_PSP_TIMER_WHEEL_MAX_ARM_CYCLES)
+    {
+      udCycles = udTick - udNow;
+    }
+  }
+
+  pspMachineInternalTimerCounterSetup(pWheel->uiTimer, (u32_t)udCycles);
+  pspMachineInternalTimerRun(pWheel->uiTimer);
+}
+
+/**
+* @brief - Move the timers of a list down the wheel, when the current tick reaches its slot
+*
+* @parameter - pWheel - the wheel of the hart
+* @parameter - uiList - the list
+* @return    - none
+*/
+D_PSP_TEXT_SECTION void pspTimerWheelCascade(pspTimerWheel_t* pWheel, u32_t uiList)
+{
+  pspTimerWheelTimer_t* pTimer = pWheel->pList[uiList];
+  pspTimerWheelTimer_t* pNext;
+
+  /* Take the whole list first - a timer of the overflow list may go back to it */
+  pWheel->pList[uiList] = NULL;
+  if (D_PSP_TIMER_WHEEL_OVERFLOW_LIST != uiList)
+  {
+    uiList -= D_PSP_TIMER_WHEEL_FIRST_LIST;
+    pWheel->uiSlotsBitmap[uiList / D_PSP_TIMER_WHEEL_SLOTS] = pspBitmanipBitClear(pWheel->uiSlotsBitmap[uiList / D_PSP_TIMER_WHEEL_SLOTS],
+                                                                                  uiList % D_PSP_TIMER_WHEEL_SLOTS);
+  }
+
+  while (NULL != pTimer)
+  {
+    pNext = pTimer->pNext;
+    pspTimerWheelInsert(pWheel, pTimer);
+    pTimer = pNext;
+  }
+}
+
+/**
+* @brief - Initialize the timing wheel of the current hart on an internal timer. The machine
+*          interrupts must be enabled by the caller
+*
+* @parameter - uiTimer - D_PSP_INTERNAL_TIMER0 or D_PSP_INTERNAL_TIMER1
+* @return    - none
+*/
+D_PSP_TEXT_SECTION void pspTimerWheelInit(u32_t uiTimer)
+{
+  pspTimerWheel_t* pWheel = &g_stPspTimerWheel[M_PSP_TIMER_WHEEL_HART_ID()];
+  u32_t uiInterruptsState;
+
+  M_PSP_ASSERT((D_PSP_INTERNAL_TIMER0 == uiTimer) || (D_PSP_INTERNAL_TIMER1 == uiTimer));
+
+  pspMachineInterruptsDisable(&uiInterruptsState);
+
+  pspMemsetBytes(pWheel, 0, sizeof(pspTimerWheel_t));
+  pWheel->uiTimer = uiTimer;
+  pWheel->udTick = M_PSP_TIMER_WHEEL_CYCLES() >> D_PSP_TIMER_WHEEL_TICK_SHIFT;
+
+  if (D_PSP_INTERNAL_TIMER0 == uiTimer)
+  {
+    pspMachineInterruptsRegisterIsr(pspTimerWheelIsr, E_MACHINE_INTERNAL_TIMER0_CAUSE);
+    pspMachineInterruptsEnableIntNumber(D_PSP_INTERRUPTS_MACHINE_INTERNAL_TIMER0);
+  }
+  else
+  {
+    pspMachineInterruptsRegisterIsr(pspTimerWheelIsr, E_MACHINE_INTERNAL_TIMER1_CAUSE);
+    pspMachineInterruptsEnableIntNumber(D_PSP_INTERRUPTS_MACHINE_INTERNAL_TIMER1);
+  }
+  pspTimerWheelArm(pWheel, D_PSP_TIMER_WHEEL_NO_TICK);
+
+  pspMachineInterruptsRestore(uiInterruptsState);
+}
+
+/**
+* @brief - Start a timer on the wheel of the current hart. A running timer is restarted
+*
+* @parameter - pTimer          - the timer
+* @parameter - uiTimeoutCycles - cycles from now to the first expiration
+* @parameter - uiPeriodCycles  - cycles between the next expirations. 0 - one-shot
+* @parameter - fptrCallback    - called in interrupt context on every expiration
+* @parameter - pArg            - argument of the callback
+* @return    - none
+*/
+D_PSP_TEXT_SECTION void pspTimerWheelTimerStart(pspTimerWheelTimer_t* pTimer, u32_t uiTimeoutCycles, u32_t uiPeriodCycles,
+                                                fptrPspTimerWheelCallback_t fptrCallback, void* pArg)
+{
+  pspTimerWheel_t* pWheel = &g_stPspTimerWheel[M_PSP_TIMER_WHEEL_HART_ID()];
+  u32_t uiInterruptsState;
+  u64_t udNow, udNextTick;
+
+  M_PSP_ASSERT((NULL != pTimer) && (NULL != fptrCallback));
+
+  pspMachineInterruptsDisable(&uiInterruptsState);
+
+  if (D_PSP_TIMER_WHEEL_NOT_ACTIVE != pTimer->uiList)
+  {
+    pspTimerWheelRemove(pWheel, pTimer);
+  }
+
+  udNow = M_PSP_TIMER_WHEEL_CYCLES();
+  pTimer->udExpiryCycles = udNow + uiTimeoutCycles;
+  pTimer->uiPeriodCycles = uiPeriodCycles;
+  pTimer->fptrCallback = fptrCallback;
+  pTimer->pArg = pArg;
+
+  /* Nothing is due until now - bring the wheel to now, so the timer goes to the lowest
+     level it can */
+  if (pspTimerWheelNextTick(pWheel) > (udNow >> D_PSP_TIMER_WHEEL_TICK_SHIFT))
+  {
+    pWheel->udTick = udNow >> D_PSP_TIMER_WHEEL_TICK_SHIFT;
+  }
+
+  pspTimerWheelInsert(pWheel, pTimer);
+
+  /* The timer expires before the tick the internal timer is set to */
+  udNextTick = pspTimerWheelNextTick(pWheel);
+  if (udNextTick < pWheel->udArmedTick)
+  {
+    pspTimerWheelArm(pWheel, udNextTick);
+  }
+
+  pspMachineInterruptsRestore(uiInterruptsState);
+}
+
+/**
+* @brief - Stop a timer. Nothing is done if it is not running
+*
+* @parameter - pTimer - the timer
+* @return    - none
+*/
+D_PSP_TEXT_SECTION void pspTimerWheelTimerStop(pspTimerWheelTimer_t* pTimer)
+{
+  u32_t uiInterruptsState;
+
+  M_PSP_ASSERT(NULL != pTimer);
+
+  pspMachineInterruptsDisable(&uiInterruptsState);
+
+  /* The internal timer is left as is - if it was set for this timer, its interrupt finds
+     nothing to expire */
+  if (D_PSP_TIMER_WHEEL_NOT_ACTIVE != pTimer->uiList)
+  {
+    pspTimerWheelRemove(&g_stPspTimerWheel[M_PSP_TIMER_WHEEL_HART_ID()], pTimer);
+  }
+
+  pspMachineInterruptsRestore(uiInterruptsState);
+}
+
+/**
+* @brief - Check whether a timer is running
+*
+* @parameter - pTimer - the timer
+* @return    - D_PSP_TRUE if the timer is running, D_PSP_FALSE otherwise
+*/
+D_PSP_TEXT_SECTION u32_t pspTimerWheelTimerIsActive(pspTimerWheelTimer_t* pTimer)
+{
+  return (D_PSP_TIMER_WHEEL_NOT_ACTIVE != pTimer->uiList) ? D_PSP_TRUE : D_PSP_FALSE;
+}
+
+/**
+* @brief - Expire the due timers and set the internal timer to the next expiration. Called
+*          from the internal timer interrupt
+*
+* @parameter - none
+* @return    - none
+*/
+D_PSP_TEXT_SECTION void pspTimerWheelIsr(void)
+{
+  pspTimerWheel_t* pWheel = &g_stPspTimerWheel[M_PSP_TIMER_WHEEL_HART_ID()];
+  pspTimerWheelTimer_t* pTimer;
+  u64_t udNowTick = M_PSP_TIMER_WHEEL_CYCLES() >> D_PSP_TIMER_WHEEL_TICK_SHIFT;
+  u64_t udTick;
+  u32_t uiLevel, uiList;
+
+  while ((udTick = pspTimerWheelNextTick(pWheel)) <= udNowTick)
+  {
+    pWheel->udTick = udTick;
+
+    /* The levels wrapped - sort out the overflow list */
+    if (0 == (udTick & ((1ULL << D_PSP_TIMER_WHEEL_LEVELS_BITS) - 1)))
+    {
+      pspTimerWheelCascade(pWheel, D_PSP_TIMER_WHEEL_OVERFLOW_LIST);
+    }
+
+    /* Cascade the slots that start at this tick, from the top level down */
+    for (uiLevel = D_PSP_TIMER_WHEEL_LEVELS - 1; uiLevel > 0; uiLevel--)
+    {
+      if (0 == (udTick & ((1ULL << (uiLevel * D_PSP_TIMER_WHEEL_SLOT_BITS)) - 1)))
+      {
+        pspTimerWheelCascade(pWheel, M_PSP_TIMER_WHEEL_LIST(uiLevel, M_PSP_TIMER_WHEEL_DIGIT(udTick, uiLevel)));
+      }
+    }
+
+    /* Expire the timers of this tick. A periodic timer is put back first, so its callback
+       may stop it. A period that already passed expires again in this loop */
+    uiList = M_PSP_TIMER_WHEEL_LIST(0, M_PSP_TIMER_WHEEL_DIGIT(udTick, 0));
+    while (NULL != (pTimer = pWheel->pList[uiList]))
+    {
+      pspTimerWheelRemove(pWheel, pTimer);
+      if (0 != pTimer->uiPeriodCycles)
+      {
+        pTimer->udExpiryCycles += pTimer->uiPeriodCycles;
+        pspTimerWheelInsert(pWheel, pTimer);
+      }
+      pTimer->fptrCallback(pTimer->pArg);
+    }
+  }
+
+  pspTimerWheelArm(pWheel, udTick);
+}
@@ -36,6 +36,11 @@
   #error "D_MTIME_ADDRESS or D_MTIMECMP_ADDRESS are not defined"
 #endif
 
+/* Words of the 64-bit mtime and mtimecmp registers */
+#define D_PSP_MTIME_LOW_WORD      0
+#define D_PSP_MTIME_HIGH_WORD     1
+#define D_PSP_MTIME_LOW_WORD_MAX  0xFFFFFFFF
+
 /**
 * macros
 */
@@ -70,15 +75,30 @@
 *
 */
 D_PSP_TEXT_SECTION void pspMachineTimerCounterSetupAndRun(u64_t udPeriodCycles)
+{
+  pspMachineTimerCompareCounterSet(pspMachineTimerCounterGet() + udPeriodCycles);
+}
+
+/**
+* @brief Set Machine Timer compare counter to an absolute time. The timer interrupt
+*        fires once the timer counter reaches it (immediately if it already passed it)
+*
+*
+* @param - udCompareCycles  - timer counter value to interrupt at
+*
+*/
+D_PSP_TEXT_SECTION void pspMachineTimerCompareCounterSet(u64_t udCompareCycles)
 {
   M_PSP_ASSERT((D_PSP_MTIME_ADDRESS != 0) && (D_PSP_MTIMECMP_ADDRESS != 0));
 
-  /* Set the mtime and mtimecmp (memory-mapped registers) per privileged spec */
-  volatile u64_t *pMtime       = (u64_t*)D_PSP_MTIME_ADDRESS;
-  volatile u64_t *pMtimecmp    = (u64_t*)D_PSP_MTIMECMP_ADDRESS;
-  u64_t udNow = *pMtime;
-  u64_t udThen = udNow + udPeriodCycles;
-  *pMtimecmp = udThen;
+  /* Set the mtimecmp (memory-mapped register) per privileged spec */
+  volatile u32_t *pMtimecmp    = (u32_t*)D_PSP_MTIMECMP_ADDRESS;
+
+  /* On RV32 mtimecmp is written a word at a time. The low word is set to its maximum first,
+   * so the compare value never drops below the new one (no spurious interrupt) in between */
+  pMtimecmp[D_PSP_MTIME_LOW_WORD]  = D_PSP_MTIME_LOW_WORD_MAX;
+  pMtimecmp[D_PSP_MTIME_HIGH_WORD] = (u32_t)(udCompareCycles >> D_PSP_SHIFT_32);
+  pMtimecmp[D_PSP_MTIME_LOW_WORD]  = (u32_t)udCompareCycles;
 }
 
 /**
@@ -90,8 +110,18 @@ D_PSP_TEXT_SECTION void pspMachineTimerCounterSetupAndRun(u64_t udPeriodCycles)
 */
 D_PSP_TEXT_SECTION u64_t pspMachineTimerCounterGet(void)
 {
-  volatile u64_t *pMtime       = (u64_t*)D_PSP_MTIME_ADDRESS;
-  return *pMtime;
+  volatile u32_t *pMtime       = (u32_t*)D_PSP_MTIME_ADDRESS;
+  u32_t uiHigh, uiLow;
+
+  /* On RV32 mtime is read a word at a time. The high word is read before and after the
+   * low word; if it changed, the low word wrapped in between and is read again */
+  do
+  {
+    uiHigh = pMtime[D_PSP_MTIME_HIGH_WORD];
+    uiLow  = pMtime[D_PSP_MTIME_LOW_WORD];
+  } while (uiHigh != pMtime[D_PSP_MTIME_HIGH_WORD]);
+
+  return (((u64_t)uiHigh << D_PSP_SHIFT_32) | uiLow);
 }
 
 /**
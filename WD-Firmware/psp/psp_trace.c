@@ -0,0 +1,226 @@
+/*
+* SPDX-License-Identifier: Apache-2.0
+* Copyright 2026 Western Digital Corporation or its affiliates.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http:*www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+/**
+* @file   psp_trace.c
+* @author Western Digital
+* @date   16.10.2026
+* @brief  The file supplies latency tracing of interrupts and exceptions. The vector
+*         tables stamp mcycle at vector entry, handler start, handler end and trap exit
+*         (M_PSP_TRACE_INT_XXX macros) and pspTraceIntUpdate accumulates the statistics
+*/
+
+/**
+* include files
+*/
+#include "psp_api.h"
+
+#ifdef D_PSP_TRACE_INT
+
+/**
+* definitions
+*/
+#define D_PSP_TRACE_INT_MCAUSE_INT_MASK    0x80000000
+
+/**
+* macros
+*/
+#ifdef D_SWERV_EH2
+  #define M_PSP_TRACE_INT_HART_ID()    M_PSP_MACHINE_GET_HART_ID()
+#else
+  #define M_PSP_TRACE_INT_HART_ID()    0
+#endif
+
+/**
+* types
+*/
+
+/**
+* local prototypes
+*/
+
+/**
+* external prototypes
+*/
+
+/**
+* global variables
+*/
+/* Time stamps of the trap in progress - written by the vector table */
+D_PSP_DCCM_DATA_SECTION pspTraceIntStamps_t g_stPspTraceIntStamps[D_PSP_NUM_OF_HARTS];
+
+/* Statistics per trace-id */
+D_PSP_DCCM_DATA_SECTION pspTraceIntStats_t g_stPspTraceIntStats[D_PSP_NUM_OF_HARTS][D_PSP_TRACE_INT_NUM_IDS];
+
+/**
+* APIs
+*/
+
+/**
+* @brief - Get the histogram bin of an interval: 0 for 0 cycles, otherwise 1 + log2(interval)
+*
+* @parameter - uiCycles - interval in cycles
+* @return    - u32_t    - histogram bin
+*/
+D_PSP_ALWAYS_INLINE u32_t pspTraceIntHistBin(u32_t uiCycles)
+{
+  /* clz of 0 is 32, so 0 cycles fall in bin 0 */
+  u32_t uiBin = D_PSP_BITMANIP_WORD_BITS - pspBitmanipClz(uiCycles);
+
+  if (D_PSP_TRACE_INT_HIST_BINS <= uiBin)
+  {
+    uiBin = D_PSP_TRACE_INT_HIST_BINS - 1;
+  }
+
+  return uiBin;
+}
+
+/**
+* @brief - Accumulate an interval into the measure statistics
+*
+* @parameter - pMeasure - measure to update
+* @parameter - uiCycles - interval in cycles
+* @parameter - uiCount  - number of traps already accumulated
+* @return    - none
+*/
+D_PSP_ALWAYS_INLINE void pspTraceIntMeasureUpdate(pspTraceIntMeasure_t* pMeasure, u32_t uiCycles, u32_t uiCount)
+{
+  if (0 == uiCount || uiCycles < pMeasure->uiMin)
+  {
+    pMeasure->uiMin = uiCycles;
+  }
+  if (uiCycles > pMeasure->uiMax)
+  {
+    pMeasure->uiMax = uiCycles;
+  }
+  pMeasure->udSum += uiCycles;
+}
+
+/**
+* @brief - Get the trace-id of the trap in progress
+*
+* @parameter - none
+* @return    - u32_t - trace-id
+*/
+D_PSP_ALWAYS_INLINE u32_t pspTraceIntGetTraceId(void)
+{
+  u32_t uiCause = M_PSP_READ_CSR(D_PSP_MCAUSE_NUM);
+  u32_t uiTraceId;
+
+  if (D_PSP_TRACE_INT_MCAUSE_INT_MASK & uiCause)
+  {
+    uiCause &= (D_PSP_TRACE_INT_NUM_CORE_INTS - 1);
+    uiTraceId = M_PSP_TRACE_INT_ID_INTERRUPT(uiCause);
+#ifdef D_SWERV_EH1
+    /* External interrupts are traced per PIC source - the claim-id captured by the handler */
+    if (E_MACHINE_EXTERNAL_CAUSE == uiCause)
+    {
+      uiCause = (M_PSP_READ_CSR(D_PSP_MEIHAP_NUM) & D_PSP_MEIHAP_CLAIMID_MASK) >> D_PSP_MEIHAP_CLAIMID_SHIFT;
+      if (D_PSP_TRACE_INT_EXT_SOURCES <= uiCause)
+      {
+        uiCause = D_PSP_TRACE_INT_EXT_SOURCES - 1;
+      }
+      uiTraceId = M_PSP_TRACE_INT_ID_EXT_SOURCE(uiCause);
+    }
+#endif /* D_SWERV_EH1 */
+  }
+  else
+  {
+    uiTraceId = M_PSP_TRACE_INT_ID_EXCEPTION(uiCause & (D_PSP_NUM_EXC_CAUSE - 1));
+  }
+
+  return uiTraceId;
+}
+
+/**
+* @brief - Update the statistics with the trap in progress. Called from the vector
+*          table (M_PSP_TRACE_INT_EXIT) just before the interrupted context is restored.
+*          The trap exit stamp is taken here. Interrupts are disabled at this point
+*
+* @parameter - none
+* @return    - none
+*/
+D_PSP_TEXT_SECTION void pspTraceIntUpdate(void)
+{
+  u32_t uiExit = M_PSP_READ_CSR(D_PSP_MCYCLE_NUM);
+  u32_t uiHartNumber = M_PSP_TRACE_INT_HART_ID();
+  pspTraceIntStamps_t* pStamps = &g_stPspTraceIntStamps[uiHartNumber];
+  pspTraceIntStats_t* pStats = &g_stPspTraceIntStats[uiHartNumber][pspTraceIntGetTraceId()];
+  u32_t uiLatency = pStamps->uiHandlerStart - pStamps->uiEntry;
+  u32_t uiTotal = uiExit - pStamps->uiEntry;
+
+  pspTraceIntMeasureUpdate(&pStats->stLatency, uiLatency, pStats->uiCount);
+  pspTraceIntMeasureUpdate(&pStats->stHandler, pStamps->uiHandlerEnd - pStamps->uiHandlerStart, pStats->uiCount);
+  pspTraceIntMeasureUpdate(&pStats->stTotal, uiTotal, pStats->uiCount);
+  pStats->uiLatencyHistogram[pspTraceIntHistBin(uiLatency)]++;
+  pStats->uiTotalHistogram[pspTraceIntHistBin(uiTotal)]++;
+  pStats->uiCount++;
+}
+
+/**
+* @brief - Clear the tracing statistics of the current hart. Must be called before
+*          interrupts are enabled, as the statistics are not initialized by the loader
+*
+* @parameter - none
+* @return    - none
+*/
+D_PSP_TEXT_SECTION void pspTraceIntReset(void)
+{
+  static const pspTraceIntStats_t stZeroStats = { 0 };
+  static const pspTraceIntStamps_t stZeroStamps = { 0 };
+  u32_t uiInterruptsState, uiTraceId;
+  u32_t uiHartNumber = M_PSP_TRACE_INT_HART_ID();
+
+  pspMachineInterruptsDisable(&uiInterruptsState);
+
+  g_stPspTraceIntStamps[uiHartNumber] = stZeroStamps;
+  for (uiTraceId = 0 ; uiTraceId < D_PSP_TRACE_INT_NUM_IDS ; uiTraceId++)
+  {
+    g_stPspTraceIntStats[uiHartNumber][uiTraceId] = stZeroStats;
+  }
+
+  pspMachineInterruptsRestore(uiInterruptsState);
+}
+
+/**
+* @brief - Get the tracing statistics of a trace-id on the current hart
+*
+* @parameter - uiTraceId - trace-id (M_PSP_TRACE_INT_ID_EXCEPTION/INTERRUPT/EXT_SOURCE)
+* @parameter - pStats    - output - copy of the statistics, including the mean values
+* @return    - u32_t     - number of traps traced for this trace-id
+*/
+D_PSP_TEXT_SECTION u32_t pspTraceIntGetStats(u32_t uiTraceId, pspTraceIntStats_t* pStats)
+{
+  u32_t uiInterruptsState;
+
+  M_PSP_ASSERT(NULL != pStats && D_PSP_TRACE_INT_NUM_IDS > uiTraceId);
+
+  /* Take a consistent copy - the statistics are updated from interrupt context */
+  pspMachineInterruptsDisable(&uiInterruptsState);
+  *pStats = g_stPspTraceIntStats[M_PSP_TRACE_INT_HART_ID()][uiTraceId];
+  pspMachineInterruptsRestore(uiInterruptsState);
+
+  if (0 != pStats->uiCount)
+  {
+    pStats->stLatency.uiMean = (u32_t)(pStats->stLatency.udSum / pStats->uiCount);
+    pStats->stHandler.uiMean = (u32_t)(pStats->stHandler.udSum / pStats->uiCount);
+    pStats->stTotal.uiMean   = (u32_t)(pStats->stTotal.udSum / pStats->uiCount);
+  }
+
+  return pStats->uiCount;
+}
+
+#endif /* D_PSP_TRACE_INT */
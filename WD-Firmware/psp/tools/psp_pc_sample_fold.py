@@ -0,0 +1,242 @@
+#/*
+#* SPDX-License-Identifier: Apache-2.0
+#* Copyright 2026 Western Digital Corporation or its affiliates.
+#*
+#* Licensed under the Apache License, Version 2.0 (the "License");
+#* you may not use this file except in compliance with the License.
+#* You may obtain a copy of the License at
+#*
+#* http:*www.apache.org/licenses/LICENSE-2.0
+#*
+#* Unless required by applicable law or agreed to in writing, software
+#* distributed under the License is distributed on an "AS IS" BASIS,
+#* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+#* See the License for the specific language governing permissions and
+#* limitations under the License.
+#*/
+"""
+Symbolize the samples of the PSP PC-sampling profiler (psp_pc_sample_eh1.h) against
+the ELF image, and write them as folded stacks and a flame graph.
+
+The samples are read from either:
+  * a console log - lines of "pcs <hart> <context> <pc> <ra>" in hex, as printed by
+    demo_pc_sample.c
+  * a binary dump of g_stPspPcSampleBuffer taken by the debugger, e.g. in gdb:
+    dump binary value samples.bin g_stPspPcSampleBuffer
+
+Each sample gives a stack of hart;context;caller;function, where the function is
+expanded with its inlined frames. The caller is found by the return address, which is
+exact for leaf functions only - in other functions ra may still hold the return address
+of their last call, in which case the caller is dropped.
+
+Usage:
+  psp_pc_sample_fold.py -e app.elf -l console.log -o app.folded -s app.svg
+  psp_pc_sample_fold.py -e app.elf -b samples.bin --harts 2 -o app.folded
+"""
+
+import argparse
+import collections
+import re
+import struct
+import subprocess
+import sys
+
+STR_ADDR2LINE = "riscv64-unknown-elf-addr2line"
+STR_LOG_SAMPLE_RE = r"pcs\s+([0-9a-fA-F]+)\s+([0-9a-fA-F]+)\s+([0-9a-fA-F]+)\s+([0-9a-fA-F]+)"
+STR_UNKNOWN = "??"
+
+# pspPcSampleBuffer_t - uiNumOfWritten, uiNumOfRead, uiNumOfLost, uiTimer, uiPeriodCycles,
+# uiJitterSeed and fptrFrameGet, followed by the samples of 4 u32_t each
+INT_BUFFER_HEADER_WORDS = 7
+INT_SAMPLE_WORDS = 4
+INT_DEFAULT_BUFFER_SIZE = 256
+
+# ra minus this is within the call instruction, compressed or not
+INT_CALL_OFFSET = 2
+
+# Flame graph layout
+INT_SVG_WIDTH = 1200
+INT_SVG_FRAME_HEIGHT = 16
+INT_SVG_FONT_SIZE = 11
+INT_SVG_CHAR_WIDTH = 7
+
+
+def fnReadLogSamples(strLogFile):
+    listSamples = []
+    with open(strLogFile, "r", errors="replace") as fLog:
+        for strLine in fLog:
+            objMatch = re.search(STR_LOG_SAMPLE_RE, strLine)
+            if objMatch:
+                listSamples.append(tuple(int(strField, 16) for strField in objMatch.groups()))
+    return listSamples
+
+
+def fnReadBinarySamples(strBinFile, intHarts, intBufferSize, intPtrBytes):
+    with open(strBinFile, "rb") as fBin:
+        bytesDump = fBin.read()
+
+    intHeaderBytes = (INT_BUFFER_HEADER_WORDS - 1) * 4 + intPtrBytes
+    intSampleBytes = INT_SAMPLE_WORDS * 4
+    intBufferBytes = intHeaderBytes + intBufferSize * intSampleBytes
+    listSamples = []
+    for intHart in range(intHarts):
+        intOffset = intHart * intBufferBytes
+        if intOffset + intBufferBytes > len(bytesDump):
+            sys.exit("dump too short for %d harts of %d samples" % (intHarts, intBufferSize))
+        intWritten = struct.unpack_from("<I", bytesDump, intOffset)[0]
+        # The ring buffer holds the latest intBufferSize samples, oldest at intWritten
+        intCount = min(intWritten, intBufferSize)
+        for intIndex in range(intWritten - intCount, intWritten):
+            intSampleOffset = intOffset + intHeaderBytes + (intIndex % intBufferSize) * intSampleBytes
+            intPc, intRa, intContext, intHartId = struct.unpack_from("<4I", bytesDump, intSampleOffset)
+            listSamples.append((intHartId, intContext, intPc, intRa))
+    return listSamples
+
+
+def fnSymbolize(strAddr2line, strElfFile, setAddresses):
+    """Map each address to its frames, outermost first (inlined frames expanded)"""
+    listAddresses = sorted(setAddresses)
+    dictFrames = {}
+    if not listAddresses:
+        return dictFrames
+    listCmd = [strAddr2line, "-e", strElfFile, "-f", "-i", "-C", "-a"] + ["0x%x" % intAddr for intAddr in listAddresses]
+    try:
+        strOutput = subprocess.run(listCmd, check=True, stdout=subprocess.PIPE, universal_newlines=True).stdout
+    except (OSError, subprocess.CalledProcessError) as objError:
+        sys.exit("%s failed: %s" % (strAddr2line, objError))
+
+    # Output per address: the address line, then a function line and a file:line line per frame
+    intAddr = None
+    listLines = strOutput.splitlines()
+    intLine = 0
+    while intLine < len(listLines):
+        strLine = listLines[intLine]
+        if strLine.startswith("0x"):
+            intAddr = int(strLine, 16)
+            dictFrames[intAddr] = []
+            intLine += 1
+        else:
+            dictFrames[intAddr].insert(0, strLine.strip())
+            intLine += 2
+    return dictFrames
+
+
+def fnFold(listSamples, dictFrames, bNoContext):
+    dictStacks = collections.Counter()
+    for intHartId, intContext, intPc, intRa in listSamples:
+        listFunctions = dictFrames.get(intPc, [STR_UNKNOWN]) or [STR_UNKNOWN]
+        listCaller = dictFrames.get(intRa - INT_CALL_OFFSET, [STR_UNKNOWN]) or [STR_UNKNOWN]
+        listStack = ["hart%d" % intHartId]
+        if not bNoContext:
+            listStack.append("ctx_%x" % intContext)
+        # ra within the sampled function is a stale return address, not the caller
+        if listCaller[-1] != listFunctions[0] and listCaller[-1] != STR_UNKNOWN:
+            listStack.append(listCaller[-1])
+        listStack += listFunctions
+        dictStacks[";".join(strFrame.replace(";", ":") for strFrame in listStack)] += 1
+    return dictStacks
+
+
+def fnWriteFolded(strFoldedFile, dictStacks):
+    with open(strFoldedFile, "w") as fFolded:
+        for strStack, intCount in sorted(dictStacks.items()):
+            fFolded.write("%s %d\n" % (strStack, intCount))
+
+
+def fnBuildTree(dictStacks):
+    dictRoot = {"name": "all", "count": 0, "children": collections.OrderedDict()}
+    for strStack, intCount in sorted(dictStacks.items()):
+        dictRoot["count"] += intCount
+        dictNode = dictRoot
+        for strFrame in strStack.split(";"):
+            if strFrame not in dictNode["children"]:
+                dictNode["children"][strFrame] = {"name": strFrame, "count": 0, "children": collections.OrderedDict()}
+            dictNode = dictNode["children"][strFrame]
+            dictNode["count"] += intCount
+    return dictRoot
+
+
+def fnXmlEscape(strText):
+    return strText.replace("&", "&amp;").replace("<", "&lt;").replace(">", "&gt;").replace('"', "&quot;")
+
+
+def fnWriteSvg(strSvgFile, dictStacks, strTitle):
+    dictRoot = fnBuildTree(dictStacks)
+    listRects = []
+
+    def fnLayout(dictNode, floatX, intDepth):
+        listRects.append((dictNode, floatX, intDepth))
+        for dictChild in dictNode["children"].values():
+            fnLayout(dictChild, floatX, intDepth + 1)
+            floatX += dictChild["count"]
+
+    fnLayout(dictRoot, 0.0, 0)
+    intMaxDepth = max(intDepth for _, _, intDepth in listRects)
+    intTotal = max(dictRoot["count"], 1)
+    floatScale = float(INT_SVG_WIDTH - 20) / intTotal
+    intHeight = (intMaxDepth + 1) * INT_SVG_FRAME_HEIGHT + 50
+
+    listSvg = ['<?xml version="1.0" standalone="no"?>',
+               '<svg version="1.1" width="%d" height="%d" xmlns="http://www.w3.org/2000/svg">' % (INT_SVG_WIDTH, intHeight),
+               '<rect x="0" y="0" width="100%" height="100%" fill="#f8f8f8"/>',
+               '<text x="%d" y="24" font-size="16" font-family="Verdana" text-anchor="middle">%s</text>'
+               % (INT_SVG_WIDTH // 2, fnXmlEscape(strTitle))]
+    for dictNode, floatX, intDepth in listRects:
+        floatWidth = dictNode["count"] * floatScale
+        if floatWidth < 0.5:
+            continue
+        intY = intHeight - (intDepth + 1) * INT_SVG_FRAME_HEIGHT - 10
+        # Warm colors, stable per function name
+        intHash = sum(ord(strChar) for strChar in dictNode["name"])
+        strColor = "rgb(%d,%d,%d)" % (205 + intHash % 50, 80 + (intHash * 7) % 130, 40 + (intHash * 13) % 40)
+        strInfo = "%s (%d samples, %.2f%%)" % (dictNode["name"], dictNode["count"], 100.0 * dictNode["count"] / intTotal)
+        intChars = int(floatWidth / INT_SVG_CHAR_WIDTH)
+        strLabel = dictNode["name"] if len(dictNode["name"]) <= intChars else (dictNode["name"][:intChars - 2] + ".." if intChars > 3 else "")
+        listSvg.append('<g><title>%s</title><rect x="%.1f" y="%d" width="%.1f" height="%d" fill="%s" rx="2" ry="2"/>'
+                       '<text x="%.1f" y="%d" font-size="%d" font-family="Verdana">%s</text></g>'
+                       % (fnXmlEscape(strInfo), 10 + floatX * floatScale, intY, floatWidth, INT_SVG_FRAME_HEIGHT - 1, strColor,
+                          13 + floatX * floatScale, intY + INT_SVG_FRAME_HEIGHT - 4, INT_SVG_FONT_SIZE, fnXmlEscape(strLabel)))
+    listSvg.append("</svg>")
+
+    with open(strSvgFile, "w") as fSvg:
+        fSvg.write("\n".join(listSvg) + "\n")
+
+
+def main():
+    objParser = argparse.ArgumentParser(description="Fold PSP PC samples into stacks and a flame graph")
+    objParser.add_argument("-e", "--elf", required=True, help="ELF image the samples were taken on")
+    objGroup = objParser.add_mutually_exclusive_group(required=True)
+    objGroup.add_argument("-l", "--log", help="console log with 'pcs' lines")
+    objGroup.add_argument("-b", "--binary", help="binary dump of g_stPspPcSampleBuffer")
+    objParser.add_argument("--harts", type=int, default=1, help="number of harts in the binary dump")
+    objParser.add_argument("--buffer-size", type=int, default=INT_DEFAULT_BUFFER_SIZE, help="D_PSP_PC_SAMPLE_BUFFER_SIZE")
+    objParser.add_argument("--ptr-bytes", type=int, default=4, choices=[4, 8], help="size of a pointer on the target")
+    objParser.add_argument("--addr2line", default=STR_ADDR2LINE, help="addr2line of the toolchain")
+    objParser.add_argument("--no-context", action="store_true", help="do not split the stacks by context")
+    objParser.add_argument("-o", "--folded", required=True, help="output folded stacks (flamegraph.pl input)")
+    objParser.add_argument("-s", "--svg", help="output flame graph")
+    objArgs = objParser.parse_args()
+
+    if objArgs.log:
+        listSamples = fnReadLogSamples(objArgs.log)
+    else:
+        listSamples = fnReadBinarySamples(objArgs.binary, objArgs.harts, objArgs.buffer_size, objArgs.ptr_bytes)
+    if not listSamples:
+        sys.exit("no samples found")
+
+    setAddresses = set()
+    for _, _, intPc, intRa in listSamples:
+        setAddresses.add(intPc)
+        # ra is the instruction after the call - symbolize the call itself
+        setAddresses.add(intRa - INT_CALL_OFFSET)
+    dictFrames = fnSymbolize(objArgs.addr2line, objArgs.elf, setAddresses)
+
+    dictStacks = fnFold(listSamples, dictFrames, objArgs.no_context)
+    fnWriteFolded(objArgs.folded, dictStacks)
+    if objArgs.svg:
+        fnWriteSvg(objArgs.svg, dictStacks, "%s - %d samples" % (objArgs.elf, len(listSamples)))
+    print("%d samples, %d stacks" % (len(listSamples), len(dictStacks)))
+
+
+if __name__ == "__main__":
+    main()
@@ -87,23 +87,72 @@ not need to be guarded with a critical section. */
 
 /* Scheduler utilities. */
 #define portYIELD()                              M_PSP_ECALL()
-#define portEND_SWITCHING_ISR( xSwitchRequired ) if( xSwitchRequired ) vTaskSwitchContext()
+#ifdef D_PSP_NESTED_EXT_INT
+  /* An ISR may be preempted, so the context switch is deferred to the end of the outermost ISR */
+  extern void rtosalContextSwitchIndicationSet( void );
+  #define portEND_SWITCHING_ISR( xSwitchRequired ) if( xSwitchRequired ) rtosalContextSwitchIndicationSet()
+#else
+  #define portEND_SWITCHING_ISR( xSwitchRequired ) if( xSwitchRequired ) vTaskSwitchContext()
+#endif /* D_PSP_NESTED_EXT_INT */
 #define portYIELD_FROM_ISR( x )                  portEND_SWITCHING_ISR( x )
 /*-----------------------------------------------------------*/
 
 
+/* Tickless idle - the idle task halts the core until the next timeout instead of taking every tick */
+#if ( configUSE_TICKLESS_IDLE != 0 )
+  #ifndef D_SWERV_EH1
+    #error "configUSE_TICKLESS_IDLE is supported only on SweRV cores"
+  #endif
+  extern void rtosalSuppressTicksAndSleep( TickType_t xExpectedIdleTime );
+  #define portSUPPRESS_TICKS_AND_SLEEP( xExpectedIdleTime ) rtosalSuppressTicksAndSleep( xExpectedIdleTime )
+#endif /* configUSE_TICKLESS_IDLE */
+/*-----------------------------------------------------------*/
+
+
 /* Critical section management. */
 #define portCRITICAL_NESTING_IN_TCB          1
 extern void vTaskEnterCritical( void );
 extern void vTaskExitCritical( void );
 
-#define portSET_INTERRUPT_MASK_FROM_ISR() 0
+#if defined(D_RTOSAL_THRESHOLD_CRITICAL_SECTION) && defined(D_PSP_NESTED_EXT_INT)
+  /* ISRs may be preempted by higher priority external interrupts - mask the ones up to the kernel threshold */
+  #define portSET_INTERRUPT_MASK_FROM_ISR() ({ u32_t uxSavedStatusValue; \
+                                               pspMachineExtInterruptsDisableToThreshold(configMAX_SYSCALL_INTERRUPT_PRIORITY, &uxSavedStatusValue); \
+                                               uxSavedStatusValue; })
 
-#define portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedStatusValue ) ( void ) uxSavedStatusValue
+  #define portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedStatusValue ) pspMachineExtInterruptsRestoreThreshold(uxSavedStatusValue)
+#elif defined(D_PSP_NESTED_EXT_INT)
+  /* ISRs may be preempted by higher priority external interrupts - mask them in ISR critical sections */
+  #define portSET_INTERRUPT_MASK_FROM_ISR() ({ UBaseType_t uxSavedStatusValue; \
+                                               M_PSP_READ_AND_CLEAR_CSR(uxSavedStatusValue, D_PSP_MSTATUS_NUM, D_PSP_MSTATUS_MIE_MASK); \
+                                               uxSavedStatusValue & D_PSP_MSTATUS_MIE_MASK; })
+
+  #define portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedStatusValue ) M_PSP_SET_CSR(D_PSP_MSTATUS_NUM, uxSavedStatusValue)
+#else
+  #define portSET_INTERRUPT_MASK_FROM_ISR() 0
+
+  #define portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedStatusValue ) ( void ) uxSavedStatusValue
+#endif /* D_PSP_NESTED_EXT_INT */
 
 /* Note: There are vTaskEnterCritical that calls portDISABLE_INTERRUPTS and portEXIT_CRITICAL that calls portENABLE_INTERRUPTS.
  * So we have to use a global parameter to preserve interrupts status over disable & enable of interrupts */
 extern unsigned int g_uInterruptsPreserveMask, g_uInterruptsDisableCounter;
+#ifdef D_RTOSAL_THRESHOLD_CRITICAL_SECTION
+#ifndef D_SWERV_EH1
+  #error "D_RTOSAL_THRESHOLD_CRITICAL_SECTION is supported only on SweRV cores"
+#endif
+/* Critical sections raise the PIC threshold to configMAX_SYSCALL_INTERRUPT_PRIORITY and mask the core
+ * interrupts, instead of clearing mstatus.MIE. External interrupts of a higher priority stay unmasked,
+ * so their handlers must not use the RTOS */
+#define portDISABLE_INTERRUPTS()                         if (g_uInterruptsDisableCounter == 0) \
+                                                         { \
+                                                            pspMachineExtInterruptsDisableToThreshold(configMAX_SYSCALL_INTERRUPT_PRIORITY, &g_uInterruptsPreserveMask); \
+                                                         } \
+                                                         g_uInterruptsDisableCounter++;
+
+#define portENABLE_INTERRUPTS()                          g_uInterruptsDisableCounter = 0; \
+                                                         pspMachineExtInterruptsRestoreThreshold(g_uInterruptsPreserveMask);
+#else
 #define portDISABLE_INTERRUPTS()                         if (g_uInterruptsDisableCounter == 0) \
                                                          { \
                                                             M_PSP_READ_AND_CLEAR_CSR(g_uInterruptsPreserveMask, D_PSP_MSTATUS_NUM, D_PSP_MSTATUS_MIE_MASK); \
@@ -114,6 +163,8 @@ extern unsigned int g_uInterruptsPreserveMask, g_uInterruptsDisableCounter;
 #define portENABLE_INTERRUPTS()                          g_uInterruptsDisableCounter = 0; \
                                                          M_PSP_SET_CSR(D_PSP_MSTATUS_NUM, g_uInterruptsPreserveMask); \
 
+#endif /* D_RTOSAL_THRESHOLD_CRITICAL_SECTION */
+
 #define portENTER_CRITICAL()                              vTaskEnterCritical()
 #define portEXIT_CRITICAL()                               vTaskExitCritical()
 
@@ -132,12 +183,13 @@ extern unsigned int g_uInterruptsPreserveMask, g_uInterruptsDisableCounter;
   #endif
 
   /* Store/clear the ready priorities in a bit map. */
-  #define portRECORD_READY_PRIORITY( uxPriority, uxReadyPriorities ) ( uxReadyPriorities ) |= ( 1UL << ( uxPriority ) )
-  #define portRESET_READY_PRIORITY( uxPriority, uxReadyPriorities ) ( uxReadyPriorities ) &= ~( 1UL << ( uxPriority ) )
+  #define portRECORD_READY_PRIORITY( uxPriority, uxReadyPriorities ) ( uxReadyPriorities ) = pspBitmanipBitSet( ( uxReadyPriorities ), ( uxPriority ) )
+  #define portRESET_READY_PRIORITY( uxPriority, uxReadyPriorities ) ( uxReadyPriorities ) = pspBitmanipBitClear( ( uxReadyPriorities ), ( uxPriority ) )
 
   /*-----------------------------------------------------------*/
 
-  #define portGET_HIGHEST_PRIORITY( uxTopPriority, uxReadyPriorities ) uxTopPriority = ( 31UL - __builtin_clz( uxReadyPriorities ) )
+  /* clz command when the target has it, otherwise a C fallback instead of a libgcc call */
+  #define portGET_HIGHEST_PRIORITY( uxTopPriority, uxReadyPriorities ) uxTopPriority = ( 31UL - pspBitmanipClz( uxReadyPriorities ) )
 
 #endif /* configUSE_PORT_OPTIMISED_TASK_SELECTION */
 
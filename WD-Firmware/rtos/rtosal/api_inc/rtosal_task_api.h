@@ -33,6 +33,16 @@
 /**
 * definitions
 */
+#ifdef D_RTOSAL_TASK_PERF_COUNTERS
+   /* Counters accumulated per task - index in rtosalTaskPerfCounters_t.udCounter */
+   #define D_RTOSAL_TASK_PERF_CYCLES            0
+   #define D_RTOSAL_TASK_PERF_INSTRET           1
+   #define D_RTOSAL_TASK_PERF_EVENT0            2   /* D_PSP_COUNTER0 */
+   #define D_RTOSAL_TASK_PERF_EVENT1            3   /* D_PSP_COUNTER1 */
+   #define D_RTOSAL_TASK_PERF_EVENT2            4   /* D_PSP_COUNTER2 */
+   #define D_RTOSAL_TASK_PERF_EVENT3            5   /* D_PSP_COUNTER3 */
+   #define D_RTOSAL_TASK_PERF_NUM_OF_COUNTERS   6
+#endif /* D_RTOSAL_TASK_PERF_COUNTERS */
 
 /**
 * macros
@@ -45,6 +55,15 @@
    #error "Add appropriate RTOS definitions"
 #endif /* #ifdef D_USE_FREERTOS */
 
+#ifdef D_RTOSAL_TASK_PERF_COUNTERS
+#ifdef D_USE_FREERTOS
+   /* Thread local storage pointer of a task that points to its RTOSAL control block */
+   #define D_RTOSAL_TASK_PERF_TLS_INDEX   (configNUM_THREAD_LOCAL_STORAGE_POINTERS - 1)
+#else
+   #error "Add appropriate RTOS definitions"
+#endif /* #ifdef D_USE_FREERTOS */
+#endif /* D_RTOSAL_TASK_PERF_COUNTERS */
+
 #ifdef D_USE_FREERTOS
    #define D_MAX_PRIORITY                 (configMAX_PRIORITIES-1)
 #elif D_USE_THREADX
@@ -139,6 +158,14 @@ typedef enum rtosalPriority
    E_RTOSAL_PRIO_MAX = E_RTOSAL_PRIO_31
 } rtosalPriority_t;
 
+#ifdef D_RTOSAL_TASK_PERF_COUNTERS
+/* Performance counters accumulated while a task runs */
+typedef struct rtosalTaskPerfCounters
+{
+   u64_t udCounter[D_RTOSAL_TASK_PERF_NUM_OF_COUNTERS];
+} rtosalTaskPerfCounters_t;
+#endif /* D_RTOSAL_TASK_PERF_COUNTERS */
+
 typedef struct rtosalTask
 {
 #ifdef D_USE_FREERTOS
@@ -147,6 +174,9 @@ typedef struct rtosalTask
    #error "Add appropriate RTOS definitions"
 #endif /* #ifdef D_USE_FREERTOS */
    s08_t cTaskCB[M_TASK_CB_SIZE_IN_BYTES];
+#ifdef D_RTOSAL_TASK_PERF_COUNTERS
+   rtosalTaskPerfCounters_t stPerfCounters;
+#endif /* D_RTOSAL_TASK_PERF_COUNTERS */
 } rtosalTask_t;
 
 /* task handler definition */
@@ -254,4 +284,11 @@ void rtosalContextSwitchIndicationClear(void);
 */
 u32_t rtosalGetSchedulerState(void);
 
+#ifdef D_RTOSAL_TASK_PERF_COUNTERS
+/**
+* Get the performance counters accumulated while a task runs
+*/
+u32_t rtosalTaskGetPerfCounters(rtosalTask_t* pRtosalTaskCb, rtosalTaskPerfCounters_t* pPerfCounters);
+#endif /* D_RTOSAL_TASK_PERF_COUNTERS */
+
 #endif /* __RTOSAL_TASK_API_H__ */
@@ -120,5 +120,10 @@ u32_t rtosTimerModifyPeriod(rtosalTimer_t* pRtosalTimerCb, u32_t uiTicks, u32_t
 */
 void rtosalTimerSetPeriod(u32_t timerPeriod);
 
+/**
+* @brief - Time since the scheduler start, in nanoseconds
+*/
+u64_t rtosalGetTimeNs(void);
+
 
 #endif /* __RTOSAL_TIME_API_H__ */
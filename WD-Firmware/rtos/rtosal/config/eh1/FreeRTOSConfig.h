@@ -146,11 +146,25 @@
 #define configUSE_DAEMON_TASK_STARTUP_HOOK      0
 #define configUSE_UPDATE_STACK_PRIOR_CONTEXT_SWITCH   1
 
+/* Tickless idle - the idle task halts the core until the next timeout, instead of being woken up by
+every tick. The ticks that passed are stepped on wakeup (see rtosalSuppressTicksAndSleep) */
+#ifdef D_RTOSAL_TICKLESS_IDLE
+   #define configUSE_TICKLESS_IDLE                 1
+   #define configEXPECTED_IDLE_TIME_BEFORE_SLEEP   2
+#endif
+
 /* Run time and task stats gathering related definitions. */
 #define configGENERATE_RUN_TIME_STATS           0
 #define configUSE_TRACE_FACILITY                0
 #define configUSE_STATS_FORMATTING_FUNCTIONS    0
 
+/* Interrupt priorities. With D_RTOSAL_THRESHOLD_CRITICAL_SECTION the critical sections set the PIC
+threshold to this value, so external interrupts of a higher priority are never masked by the kernel.
+Their handlers must not use the RTOS API. */
+#ifndef configMAX_SYSCALL_INTERRUPT_PRIORITY
+   #define configMAX_SYSCALL_INTERRUPT_PRIORITY    D_PSP_EXT_INT_THRESHOLD_7
+#endif
+
 /* Co-routine definitions. */
 #define configUSE_CO_ROUTINES           0
 #define configMAX_CO_ROUTINE_PRIORITIES 1
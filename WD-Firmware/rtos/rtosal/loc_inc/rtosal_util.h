@@ -100,9 +100,9 @@ extern void (*fptrParamErrorNotification)(const void *pParam, u32_t uErrorCode);
 /**
 * @brief Activated upon Timer-tick (and invokes context-switch in the OS)
 *
-* @param None
+* @param uiNumOfTicks - ticks due; more than one when ticks were missed
 *
 */
-void rtosalTick(void);
+void rtosalTick(u32_t uiNumOfTicks);
 
 #endif /* __RTOSAL_H__ */
@@ -72,6 +72,52 @@ rtosalApplicationInit_t  fptrAppInit = NULL;
 /* application specific timer-tick handler function. The function should be implemented by the application  */
 rtosalTimerTickHandler_t fptrTimerTickHandler ;
 
+#ifdef D_RTOSAL_TASK_PERF_COUNTERS
+/* Performance counters (low 32 bits) when the running task was switched in */
+u32_t g_uiRtosalTaskPerfStart[D_RTOSAL_TASK_PERF_NUM_OF_COUNTERS];
+
+/* Performance counters of the tasks that are not created by RTOSAL (idle and timer tasks) */
+rtosalTaskPerfCounters_t g_stRtosalKernelTasksPerfCounters;
+
+/**
+* Read the low 32 bits of the accumulated performance counters
+*
+* @param  pCounters - output - D_RTOSAL_TASK_PERF_NUM_OF_COUNTERS values
+*
+* @return - none
+*/
+D_PSP_ALWAYS_INLINE void rtosalTaskPerfReadCounters(u32_t* pCounters)
+{
+   pCounters[D_RTOSAL_TASK_PERF_CYCLES]  = M_PSP_READ_CSR(D_PSP_MCYCLE_NUM);
+   pCounters[D_RTOSAL_TASK_PERF_INSTRET] = M_PSP_READ_CSR(D_PSP_MINSTRET_NUM);
+   pCounters[D_RTOSAL_TASK_PERF_EVENT0]  = M_PSP_READ_CSR(D_PSP_MHPMCOUNTER3_NUM);
+   pCounters[D_RTOSAL_TASK_PERF_EVENT1]  = M_PSP_READ_CSR(D_PSP_MHPMCOUNTER4_NUM);
+   pCounters[D_RTOSAL_TASK_PERF_EVENT2]  = M_PSP_READ_CSR(D_PSP_MHPMCOUNTER5_NUM);
+   pCounters[D_RTOSAL_TASK_PERF_EVENT3]  = M_PSP_READ_CSR(D_PSP_MHPMCOUNTER6_NUM);
+}
+
+/**
+* Get the performance counters of a task
+*
+* @param  taskHandle - RTOS handle of the task
+*
+* @return rtosalTaskPerfCounters_t* - counters in the RTOSAL control block of the task, or the
+*                                     shared counters of the tasks that are not created by RTOSAL
+*/
+D_PSP_ALWAYS_INLINE rtosalTaskPerfCounters_t* rtosalTaskPerfGetTaskCounters(void* taskHandle)
+{
+   rtosalTask_t* pRtosalTaskCb;
+
+#ifdef D_USE_FREERTOS
+   pRtosalTaskCb = (rtosalTask_t*)pvTaskGetThreadLocalStoragePointer((TaskHandle_t)taskHandle, D_RTOSAL_TASK_PERF_TLS_INDEX);
+#else
+   #error "Add appropriate RTOS definitions"
+#endif /* #ifdef D_USE_FREERTOS */
+
+   return (NULL == pRtosalTaskCb) ? &g_stRtosalKernelTasksPerfCounters : &pRtosalTaskCb->stPerfCounters;
+}
+#endif /* D_RTOSAL_TASK_PERF_COUNTERS */
+
 /**
 * Task creation function
 *
@@ -112,10 +158,22 @@ RTOSAL_SECTION u32_t rtosalTaskCreate(rtosalTask_t* pRtosalTaskCb, const s08_t*
 
 #ifdef D_USE_FREERTOS
    M_RTOSAL_VALIDATE_FUNC_PARAM(pStackBuffer, pStackBuffer == NULL, D_RTOSAL_PTR_ERROR);
+#ifdef D_RTOSAL_TASK_PERF_COUNTERS
+   pspMemsetBytes(&pRtosalTaskCb->stPerfCounters, 0, sizeof(pRtosalTaskCb->stPerfCounters));
+   /* the new task must not run before it points to its control block */
+   vTaskSuspendAll();
+#endif /* D_RTOSAL_TASK_PERF_COUNTERS */
    pRtosalTaskCb->taskHandle = xTaskCreateStatic(fptrRtosTaskEntryPoint, (const char * const) pTaskName,
                                   uiStackSize, (void*)uiTaskEntryPointParameter,
                                   (UBaseType_t)uiPriority, (StackType_t*)pStackBuffer,
                                   (StaticTask_t*)pRtosalTaskCb->cTaskCB);
+#ifdef D_RTOSAL_TASK_PERF_COUNTERS
+   if (pRtosalTaskCb->taskHandle != NULL)
+   {
+      vTaskSetThreadLocalStoragePointer(pRtosalTaskCb->taskHandle, D_RTOSAL_TASK_PERF_TLS_INDEX, pRtosalTaskCb);
+   }
+   xTaskResumeAll();
+#endif /* D_RTOSAL_TASK_PERF_COUNTERS */
    /* we need to suspend the task if required */
    if (pRtosalTaskCb->taskHandle != NULL)
    {
@@ -393,6 +451,10 @@ RTOSAL_SECTION void rtosalStart(rtosalApplicationInit_t fptrInit)
   pspMachineInterruptsRegisterIsr(rtosalTimerIntHandler, E_MACHINE_TIMER_CAUSE);
 
   fptrInit(NULL);
+#ifdef D_RTOSAL_TASK_PERF_COUNTERS
+  /* the first task is accumulated from here */
+  rtosalTaskPerfReadCounters(g_uiRtosalTaskPerfStart);
+#endif /* D_RTOSAL_TASK_PERF_COUNTERS */
   vTaskStartScheduler();
 #elif D_USE_THREADX
    #error "Add THREADX appropriate definitions"
@@ -470,6 +532,22 @@ u32_t rtosalGetSchedulerState(void)
 */
 void rtosalUpdateStackPriorContextSwitch(volatile rtosalStack_t** pxTopOfStack)
 {
+#ifdef D_RTOSAL_TASK_PERF_COUNTERS
+   u32_t uiNow[D_RTOSAL_TASK_PERF_NUM_OF_COUNTERS];
+   rtosalTaskPerfCounters_t* pPerfCounters;
+   u32_t uiCounter;
+
+   /* the top of stack is the first field of the control block, so it points to the
+      control block of the task that is switched out. Accumulate the counters since
+      it was switched in; the next task is accumulated from now */
+   rtosalTaskPerfReadCounters(uiNow);
+   pPerfCounters = rtosalTaskPerfGetTaskCounters((void*)pxTopOfStack);
+   for (uiCounter = 0 ; uiCounter < D_RTOSAL_TASK_PERF_NUM_OF_COUNTERS ; uiCounter++)
+   {
+      pPerfCounters->udCounter[uiCounter] += uiNow[uiCounter] - g_uiRtosalTaskPerfStart[uiCounter];
+      g_uiRtosalTaskPerfStart[uiCounter] = uiNow[uiCounter];
+   }
+#endif /* D_RTOSAL_TASK_PERF_COUNTERS */
 #ifdef D_COMRV
 #ifdef D_USE_FREERTOS
    u32_t*                pUiNewSP = NULL;
@@ -521,3 +599,54 @@ void rtosalUpdateStackPriorContextSwitch(volatile rtosalStack_t** pxTopOfStack)
 #endif /* D_USE_FREERTOS */
 #endif /* D_COMRV */
 }
+
+#ifdef D_RTOSAL_TASK_PERF_COUNTERS
+/**
+* Get the performance counters accumulated while a task runs: cycles, instructions retired
+* and the four event counters (D_PSP_COUNTER0..3), as programmed by pspMachinePerfCounterSet.
+* The interrupts are accumulated to the task they interrupt
+*
+* @param  pRtosalTaskCb - pointer to the task control block. NULL - the tasks that are not
+*                         created by RTOSAL (idle and timer tasks)
+* @param  pPerfCounters - output - the counters, including the current run of the task
+*
+* @return u32_t         - D_RTOSAL_SUCCESS
+*                       - D_RTOSAL_PTR_ERROR - Invalid pPerfCounters
+*/
+RTOSAL_SECTION u32_t rtosalTaskGetPerfCounters(rtosalTask_t* pRtosalTaskCb, rtosalTaskPerfCounters_t* pPerfCounters)
+{
+   u32_t uiNow[D_RTOSAL_TASK_PERF_NUM_OF_COUNTERS];
+   rtosalTaskPerfCounters_t* pTaskCounters;
+   rtosalTaskPerfCounters_t* pCurrentCounters;
+   u32_t uiInterruptsState, uiCounter;
+
+   M_RTOSAL_VALIDATE_FUNC_PARAM(pPerfCounters, pPerfCounters == NULL, D_RTOSAL_PTR_ERROR);
+
+   pTaskCounters = (NULL == pRtosalTaskCb) ? &g_stRtosalKernelTasksPerfCounters : &pRtosalTaskCb->stPerfCounters;
+
+   /* take a consistent copy - the counters are updated on context switch */
+   pspMachineInterruptsDisable(&uiInterruptsState);
+
+   *pPerfCounters = *pTaskCounters;
+
+#ifdef D_USE_FREERTOS
+   pCurrentCounters = rtosalTaskPerfGetTaskCounters(xTaskGetCurrentTaskHandle());
+#else
+   #error "Add appropriate RTOS definitions"
+#endif /* #ifdef D_USE_FREERTOS */
+
+   /* the running task - add its current run */
+   if (pCurrentCounters == pTaskCounters)
+   {
+      rtosalTaskPerfReadCounters(uiNow);
+      for (uiCounter = 0 ; uiCounter < D_RTOSAL_TASK_PERF_NUM_OF_COUNTERS ; uiCounter++)
+      {
+         pPerfCounters->udCounter[uiCounter] += uiNow[uiCounter] - g_uiRtosalTaskPerfStart[uiCounter];
+      }
+   }
+
+   pspMachineInterruptsRestore(uiInterruptsState);
+
+   return D_RTOSAL_SUCCESS;
+}
+#endif /* D_RTOSAL_TASK_PERF_COUNTERS */
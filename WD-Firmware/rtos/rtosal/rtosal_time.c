@@ -41,6 +41,15 @@
 /**
 * definitions
 */
+#define D_RTOSAL_NSEC_IN_SEC    1000000000ULL
+
+#if (configUSE_TICKLESS_IDLE != 0)
+   #ifndef D_EH1_VER_1_0
+      #error "Tickless idle needs the 'haltie' feature of SweRV EH1 version 1.0"
+   #endif
+   /* Interrupts are enabled atomically upon halt, so any interrupt pending from then on wakes the core */
+   #define D_RTOSAL_TICKLESS_ENABLE_INTERRUPTS_IN_HALT   1
+#endif /* configUSE_TICKLESS_IDLE */
 
 /**
 * macros
@@ -62,6 +71,14 @@
 * global variables
 */
 u32_t g_uTimerPeriod = 0;
+/* The ticks are on a fixed grid of g_uTimerPeriod from the scheduler start: the time of the
+   next tick on the machine timer, and the ticks taken until it (missed and tickless ones too) */
+u64_t g_udRtosalNextTickTime = 0;
+u64_t g_udRtosalTickCount = 0;
+#if (configUSE_TICKLESS_IDLE != 0)
+/* Set while the core is halted in tickless idle. The ticks are then counted on wakeup */
+volatile u32_t g_uiRtosalTicklessIdle = 0;
+#endif /* configUSE_TICKLESS_IDLE */
 
 
 /**
@@ -389,7 +406,7 @@ void rtosalTimerSetPeriod(u32_t timerPeriod)
 }
 
 /**
-* @brief rtosalTimerSetup - Setup & activates core's timer
+* @brief rtosalTimerSetup - Setup & activates core's timer. Called when the scheduler starts
 *
 * @param void
 *
@@ -399,11 +416,14 @@ void rtosalTimerSetup(void)
   /* In case g_uTimerPeriod = 0 then there is no point to activate the timer */
   M_PSP_ASSERT(0 == g_uTimerPeriod);
 
+  g_udRtosalTickCount = 0;
+  g_udRtosalNextTickTime = pspMachineTimerCounterGet() + g_uTimerPeriod;
+
   /* Enable timer interrupt */
   pspMachineInterruptsEnableIntNumber(D_PSP_INTERRUPTS_MACHINE_TIMER);
 
   /* Activates Core's timer with the calculated period */
-  pspMachineTimerCounterSetupAndRun(g_uTimerPeriod);
+  pspMachineTimerCompareCounterSet(g_udRtosalNextTickTime);
 }
 
 /**
@@ -414,13 +434,123 @@ void rtosalTimerSetup(void)
 */
 void rtosalTimerIntHandler(void)
 {
+  u64_t udNow;
+  u32_t uiNumOfTicks = 0;
+
   /* Disable Machine-Timer interrupt */
   pspMachineInterruptsDisableIntNumber(D_PSP_INTERRUPTS_MACHINE_TIMER);
 
+#if (configUSE_TICKLESS_IDLE != 0)
+  /* The timer woke the core from tickless idle - rtosalSuppressTicksAndSleep steps the
+     ticks and sets up the timer */
+  if (0 != g_uiRtosalTicklessIdle)
+  {
+    return;
+  }
+#endif /* configUSE_TICKLESS_IDLE */
+
+  /* The next tick is a period after the previous one, regardless of the interrupt latency. Ticks
+     missed while the interrupts were disabled for longer than a period are taken now */
+  udNow = pspMachineTimerCounterGet();
+  do
+  {
+    g_udRtosalNextTickTime += g_uTimerPeriod;
+    uiNumOfTicks++;
+  } while (g_udRtosalNextTickTime <= udNow);
+  g_udRtosalTickCount += uiNumOfTicks;
+
   /* Increment the RTOS tick. */
-  rtosalTick();
+  rtosalTick(uiNumOfTicks);
 
   /* Setup the Timer for next round */
-  rtosalTimerSetup();
+  pspMachineTimerCompareCounterSet(g_udRtosalNextTickTime);
+  pspMachineInterruptsEnableIntNumber(D_PSP_INTERRUPTS_MACHINE_TIMER);
+}
+
+/**
+* @brief rtosalGetTimeNs - Time since the scheduler start, in nanoseconds: the ticks taken
+*                          and the machine timer cycles since the last of them
+*
+* @param void
+*
+* @return u64_t - time in nanoseconds, 0 before the scheduler starts
+*/
+u64_t rtosalGetTimeNs(void)
+{
+  u32_t uiInterruptsState;
+  u64_t udCycles = 0;
+
+  /* The tick count and the next tick time are updated together by the timer interrupt */
+  pspMachineInterruptsDisable(&uiInterruptsState);
+  if (0 != g_udRtosalNextTickTime)
+  {
+    udCycles = g_udRtosalTickCount * g_uTimerPeriod +
+               (pspMachineTimerCounterGet() - (g_udRtosalNextTickTime - g_uTimerPeriod));
+  }
+  pspMachineInterruptsRestore(uiInterruptsState);
+
+  /* Whole seconds first, so the multiplication does not overflow */
+  return (udCycles / configRTC_CLOCK_HZ) * D_RTOSAL_NSEC_IN_SEC +
+         ((udCycles % configRTC_CLOCK_HZ) * D_RTOSAL_NSEC_IN_SEC) / configRTC_CLOCK_HZ;
 }
 
+#if (configUSE_TICKLESS_IDLE != 0)
+/**
+* @brief rtosalSuppressTicksAndSleep - Tickless idle (portSUPPRESS_TICKS_AND_SLEEP). Called by the idle task,
+*                                      with the scheduler suspended, when no task is due for a few ticks.
+*                                      The timer is set to the tick of the next timeout and the core is
+*                                      halted. Any interrupt wakes it up; the ticks that passed are then
+*                                      stepped and the timer is set back to the next tick
+*
+* @param xExpectedIdleTime - ticks until the next task timeout
+*
+*/
+void rtosalSuppressTicksAndSleep(TickType_t xExpectedIdleTime)
+{
+  u32_t uiInterruptsState;
+  TickType_t xElapsedTicks, xSteppedTicks;
+  u64_t udLastTick;
+
+  pspMachineInterruptsDisable(&uiInterruptsState);
+
+  /* A task became ready, or a context switch was requested, since the idle task decided to sleep */
+  if (eAbortSleep == eTaskConfirmSleepModeStatus())
+  {
+    pspMachineInterruptsRestore(uiInterruptsState);
+    return;
+  }
+
+  udLastTick = g_udRtosalNextTickTime - g_uTimerPeriod;
+
+  g_uiRtosalTicklessIdle = 1;
+  pspMachineTimerCompareCounterSet(udLastTick + (u64_t)xExpectedIdleTime * g_uTimerPeriod);
+  pspMachineInterruptsEnableIntNumber(D_PSP_INTERRUPTS_MACHINE_TIMER);
+
+  /* Halt until the timeout or any other interrupt. The interrupt is handled before the halt returns */
+  pspMachinePowerMngCtrlHalt(D_RTOSAL_TICKLESS_ENABLE_INTERRUPTS_IN_HALT);
+
+  /* The halt left the interrupts enabled - disable them again; uiInterruptsState is restored at the end */
+  M_PSP_CLEAR_CSR(D_PSP_MSTATUS_NUM, D_PSP_MSTATUS_MIE_MASK);
+  g_uiRtosalTicklessIdle = 0;
+
+  /* Whole ticks that passed while halted */
+  xElapsedTicks = (TickType_t)((pspMachineTimerCounterGet() - udLastTick) / g_uTimerPeriod);
+
+  /* Step the ticks before the timeout. The tick of the timeout, and any tick after it, is counted
+     as a pended tick, which unblocks the tasks when the idle task resumes the scheduler */
+  xSteppedTicks = (xElapsedTicks < xExpectedIdleTime) ? xElapsedTicks : (xExpectedIdleTime - 1);
+  vTaskStepTick(xSteppedTicks);
+  for (; xSteppedTicks < xElapsedTicks; xSteppedTicks++)
+  {
+    (void)xTaskIncrementTick();
+  }
+
+  /* Back to a tick per period, on the tick boundaries from before the sleep */
+  g_udRtosalTickCount += xElapsedTicks;
+  g_udRtosalNextTickTime = udLastTick + ((u64_t)xElapsedTicks + 1) * g_uTimerPeriod;
+  pspMachineTimerCompareCounterSet(g_udRtosalNextTickTime);
+  pspMachineInterruptsEnableIntNumber(D_PSP_INTERRUPTS_MACHINE_TIMER);
+
+  pspMachineInterruptsRestore(uiInterruptsState);
+}
+#endif /* configUSE_TICKLESS_IDLE */
@@ -118,14 +118,25 @@ RTOSAL_SECTION u32_t rtosalIsInterruptContext(void)
 /**
 * This function is invoked by the system timer interrupt
 *
-* @param  none
+* @param  uiNumOfTicks - ticks due; more than one when ticks were missed
 *
 * @return none
 */
-RTOSAL_SECTION void rtosalTick(void)
+RTOSAL_SECTION void rtosalTick(u32_t uiNumOfTicks)
 {
 #ifdef D_USE_FREERTOS
-   if (xTaskIncrementTick() == D_PSP_TRUE)
+   u32_t uiSwitchRequired = D_PSP_FALSE;
+
+   /* Missed ticks are replayed one by one, so no timeout is skipped */
+   while (uiNumOfTicks-- > 0)
+   {
+      if (xTaskIncrementTick() == D_PSP_TRUE)
+      {
+         uiSwitchRequired = D_PSP_TRUE;
+      }
+   }
+
+   if (uiSwitchRequired == D_PSP_TRUE)
    {
            vTaskSwitchContext();
    }